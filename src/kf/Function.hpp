@@ -44,7 +44,7 @@ private:
         }
 
         Base *clone_to(void *dest) const noexcept override {
-            new(dest) Impl(f);
+            new(dest) Impl(Fn(f));
             return reinterpret_cast<Base *>(dest);
         }
     };
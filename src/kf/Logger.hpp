@@ -6,6 +6,8 @@
 #include <Arduino.h>
 
 #include "kf/aliases.hpp"
+#include "kf/fmt.hpp"
+#include "kf/math/units.hpp"
 #include "kf/memory/StringView.hpp"
 #include "kf/pattern/Singleton.hpp"
 
@@ -19,55 +21,39 @@ struct Logger final : Singleton<Logger> {
 
     using WriteHandler = void (*)(StringView);///< Output handler function type
 
+    static constexpr usize line_capacity{128};///< Maximum log line length including newline
+
     WriteHandler writer{nullptr};///< Current output handler (nullptr disables logging)
 
-    /// @brief Internal log message formatting and output
+    /// @brief Internal log message formatting
+    /// @note Only message formatting is instantiated per pattern, line assembly is shared (see write)
     /// @param level Log level string
     /// @param f Source file name
-    /// @param format printf-style format string
-    /// @param ... Variable arguments matching format specifiers
-    void log(const char *level, const char *f, const char *format, ...) const noexcept {
+    /// @param pattern Message pattern made by kf_fmt("...") (see kf::fmt::write)
+    /// @param args Arguments matching pattern conversions
+    template<typename P, typename... Args> void log(const char *level, const char *f, P pattern, const Args &...args) const noexcept {
         if (writer == nullptr) { return; }
 
-        char buffer[128];
-        size_t pos = 0;
-
-        // Format prefix [timestamp|level|file]
-        int prefix_len = snprintf(buffer, sizeof(buffer),
-                                  "[%lu|%s|%s] ",
-                                  millis(), level, f);
-
-        if (prefix_len > 0) {
-            pos = min(static_cast<usize>(prefix_len), sizeof(buffer) - 1);
-        }
-
-        // Format main message
-        if (pos < sizeof(buffer)) {
-            va_list args;
-            va_start(args, format);
-            int msg_len = vsnprintf(
-                buffer + pos,
-                sizeof(buffer) - pos,
-                format,
-                args);
-            va_end(args);
-
-            if (msg_len > 0) {
-                pos += min(static_cast<size_t>(msg_len), sizeof(buffer) - pos - 1);
-            }
-        }
-
-        // Add newline
-        if (pos < sizeof(buffer) - 1) {
-            buffer[pos] = '\n';
-            pos++;
-        } else {
-            // If buffer full, replace last character with newline
-            buffer[sizeof(buffer) - 2] = '\n';
-            pos = sizeof(buffer) - 1;
-        }
-
-        writer({buffer, pos});
+        char message[line_capacity];
+        const usize size = fmt::write(Slice<char>{message, sizeof(message)}, pattern, args...);
+
+        write(level, f, StringView{message, size});
+    }
+
+    /// @brief Internal log line assembly and output
+    /// @param level Log level string
+    /// @param f Source file name
+    /// @param message Formatted message
+    void write(const char *level, const char *f, StringView message) const noexcept {
+        char buffer[line_capacity];
+
+        // Prefix [timestamp|level|file], message and newline (always kept)
+        fmt::Writer line{buffer, sizeof(buffer) - 1};
+        line.size = fmt::write(Slice<char>{buffer, sizeof(buffer) - 1}, kf_fmt("[%u|%s|%s] "), static_cast<Milliseconds>(millis()), level, f);
+        line.text(message.data(), message.size());
+        buffer[line.size] = '\n';
+
+        writer({buffer, line.size + 1});
     }
 };
 
@@ -106,41 +92,46 @@ struct Logger final : Singleton<Logger> {
 #endif
 
 /// @brief Log debug message (enabled when kf_Logger_level <= debug)
-/// @param ... printf-style format string and arguments
+/// @param format Format string literal (checked at compile time, see kf::fmt::write)
+/// @param ... Arguments matching format conversions
 #if kf_Logger_level_debug >= kf_Logger_level
-#define kf_Logger_debug(...) kf::Logger::instance().log("Debug", __FILE__, __VA_ARGS__)
+#define kf_Logger_debug(format, ...) kf::Logger::instance().log("Debug", __FILE__, kf_fmt(format), ##__VA_ARGS__)
 #else
 #define kf_Logger_debug(...)
 #endif
 
 /// @brief Log info message (enabled when kf_Logger_level <= info)
-/// @param ... printf-style format string and arguments
+/// @param format Format string literal (checked at compile time, see kf::fmt::write)
+/// @param ... Arguments matching format conversions
 #if kf_Logger_level_info >= kf_Logger_level
-#define kf_Logger_info(...) kf::Logger::instance().log("Info", __FILE__, __VA_ARGS__)
+#define kf_Logger_info(format, ...) kf::Logger::instance().log("Info", __FILE__, kf_fmt(format), ##__VA_ARGS__)
 #else
 #define kf_Logger_info(...)
 #endif
 
 /// @brief Log warning message (enabled when kf_Logger_level <= warn)
-/// @param ... printf-style format string and arguments
+/// @param format Format string literal (checked at compile time, see kf::fmt::write)
+/// @param ... Arguments matching format conversions
 #if kf_Logger_level_warn >= kf_Logger_level
-#define kf_Logger_warn(...) kf::Logger::instance().log("Warn", __FILE__, __VA_ARGS__)
+#define kf_Logger_warn(format, ...) kf::Logger::instance().log("Warn", __FILE__, kf_fmt(format), ##__VA_ARGS__)
 #else
 #define kf_Logger_warn(...)
 #endif
 
 /// @brief Log error message (enabled when kf_Logger_level <= error)
-/// @param ... printf-style format string and arguments
+/// @param format Format string literal (checked at compile time, see kf::fmt::write)
+/// @param ... Arguments matching format conversions
 #if kf_Logger_level_error >= kf_Logger_level
-#define kf_Logger_error(...) kf::Logger::instance().log("Error", __FILE__, __VA_ARGS__)
+#define kf_Logger_error(format, ...) kf::Logger::instance().log("Error", __FILE__, kf_fmt(format), ##__VA_ARGS__)
 #else
 #define kf_Logger_error(...)
 #endif
 
 /// @brief Log fatal message (enabled when kf_Logger_level <= fatal)
-/// @param ... printf-style format string and arguments
+/// @param format Format string literal (checked at compile time, see kf::fmt::write)
+/// @param ... Arguments matching format conversions
 #if kf_Logger_level_fatal >= kf_Logger_level
-#define kf_Logger_fatal(...) kf::Logger::instance().log("Fatal", __FILE__, __VA_ARGS__)
+#define kf_Logger_fatal(format, ...) kf::Logger::instance().log("Fatal", __FILE__, kf_fmt(format), ##__VA_ARGS__)
 #else
 #define kf_Logger_fatal(...)
 #endif
\ No newline at end of file
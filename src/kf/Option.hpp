@@ -34,7 +34,7 @@ public:
 
     /// @brief Check if Option contains a value
     /// @return true if value is present, false otherwise
-    kf_nodiscard bool hasValue() const noexcept { return engaged; }
+    kf_nodiscard constexpr bool hasValue() const noexcept { return engaged; }
 
     /// @brief Get stored value (unsafe)
     /// @return Reference to stored value
@@ -52,7 +52,7 @@ public:
     /// @param default_value Value to return if Option is empty
     /// @return Stored value if present, default_value otherwise
     /// @note Safe alternative to value() that doesn't terminate
-    kf_nodiscard T valueOr(const T &default_value) const noexcept {
+    kf_nodiscard constexpr T valueOr(const T &default_value) const noexcept {
         return engaged ? val : default_value;
     }
 };
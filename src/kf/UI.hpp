@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <tuple>
 #include <utility>
 #include <type_traits>
 
@@ -12,10 +13,9 @@
 #include "kf/core/attributes.hpp"
 #include "kf/memory/Array.hpp"
 #include "kf/memory/StringView.hpp"
-#include "kf/memory/ArrayList.hpp"
-#include "kf/memory/Queue.hpp"
-#include "kf/pattern/Singleton.hpp"
+#include "kf/memory/SpscQueue.hpp"
 #include "kf/ui/Event.hpp"
+#include "kf/ui/Profiler.hpp"
 #include "kf/math/units.hpp"
 
 
@@ -23,9 +23,15 @@ namespace kf {
 
 /// @brief User interface framework with widget-based rendering
 /// @tparam R Renderer implementation type (must inherit from kf::ui::Render)
-/// @note Singleton pattern ensures single UI instance with event queue and page management
-template<typename R, typename E> struct UI final : Singleton<UI<R, E>> {
-    friend struct Singleton<UI<R, E>>;
+/// @tparam E Event type (kf::ui::Event)
+/// @tparam Q Event queue capacity (power of two)
+/// @tparam P Maximum widget count per page
+/// @note Each UI instance is independent context with own pages, event queue, renderer and render scheduler.
+/// Pages belong to context given on construction (instance() if omitted).
+/// @note UI never allocates: pages and event queue have fixed capacity
+template<typename R, typename E, usize Q = 16, usize P = 16> struct UI final {
+
+    static_assert(P >= 1, "P >= 1");
 
     using RenderImpl = R;                             ///< Renderer implementation type
     using RenderConfig = typename RenderImpl::Config; ///< Renderer Configuration type
@@ -33,15 +39,41 @@ template<typename R, typename E> struct UI final : Singleton<UI<R, E>> {
     using Event = E;                          ///< UI Event type
     using EventValue = typename Event::Value; ///< UI Event Value type
 
-    struct Page; // forward declaration for Widget
+    using EventQueue = SpscQueue<typename Event::Storage, Q>;///< Lock-free queue of packed events
+
+    /// @brief Limits of event dispatch work done by single poll()
+    struct DispatchBudget {
+        usize max_events{20};                  ///< Maximum dispatched (coalesced) events per poll
+        Microseconds max_time{0};              ///< Maximum dispatch time per poll (0 - unlimited)
+        Function<Microseconds()> clock{nullptr};///< Time source for max_time (e.g. micros)
+    };
+
+    /// @brief Render scheduler counters
+    struct RenderStats {
+        u32 performed{0};///< Frames rendered
+        u32 skipped{0};  ///< Render requests folded into later frame by frame interval
+    };
+
+#if kf_UI_profiling
+    using Profiler = ui::Profiler<P, (1u << Event::type_bits)>;///< UI timing collector type
+#endif
+
+    struct BasicPage; // forward declaration for Widget
+    struct Page;      // forward declaration for Widget
 
     /// @brief Base widget class for all UI components
     /// @note All interactive UI elements inherit from this class
     struct Widget {
+        friend struct BasicPage;
+
+    private:
+        bool dirty{true};///< Widget content changed since last render
+
+    public:
         /// @brief Construct widget and add to specified page
         /// @param root Page to add widget to
         explicit Widget(Page &root) {
-            root.addWidget(*this);
+            (void) root.addWidget(*this);
         }
 
         /// @brief Default constructor (widget not attached to any page)
@@ -56,9 +88,21 @@ template<typename R, typename E> struct UI final : Singleton<UI<R, E>> {
         virtual bool onClick() noexcept { return false; }
 
         /// @brief Handle value event
+        /// @param value Signed step, may be sum of several queued same-sign steps (never 0 after merge)
         /// @return true if redraw required, false otherwise
         virtual bool onValue(EventValue value) noexcept { return false; }
 
+        /// @brief Check externally driven state (called on every poll of active page)
+        /// @return true if redraw required, false otherwise
+        virtual bool onPoll() noexcept { return false; }
+
+        /// @brief Request widget redraw on next render
+        /// @note Event handlers returning true mark widget automatically, use for externally driven changes
+        void invalidate() noexcept { dirty = true; }
+
+        /// @brief Check if widget content changed since last render
+        kf_nodiscard bool isDirty() const noexcept { return dirty; }
+
         /// @brief External widget rendering with focus handling
         /// @param render Renderer instance to use for drawing
         /// @param focused true if widget currently has focus
@@ -73,25 +117,25 @@ template<typename R, typename E> struct UI final : Singleton<UI<R, E>> {
         }
     };
 
-    /// @brief UI page containing widgets and title
-    struct Page {
-    private:
-        /// @brief Special widget for creating page navigation buttons
-        /// @note Internal use only - use Page::link() for page navigation
-        struct PageSetter final : Widget {
+    /// @brief Common page logic: title, cursor, visible window and event routing
+    /// @note Widget storage is provided by Page (dynamic) or StaticPage (compile-time tuple)
+    struct BasicPage {
+        /// @brief Page navigation widget
+        /// @note Use Page::link() for bidirectional navigation between dynamic pages
+        struct PageLink final : Widget {
         private:
-            Page &target;///< Target page for navigation
+            BasicPage &target;///< Target page for navigation
 
         public:
             /// @brief Construct page navigation widget
             /// @param target Page to navigate to when clicked
-            explicit PageSetter(Page &target) :
+            explicit PageLink(BasicPage &target) :
                 target{target} {}
 
             /// @brief Set target page as active on click
             /// @return true (redraw always required after page change)
             bool onClick() noexcept override {
-                UI::instance().bindPage(target);
+                target.context.bindPage(target);
                 return true;
             }
 
@@ -103,16 +147,31 @@ template<typename R, typename E> struct UI final : Singleton<UI<R, E>> {
             }
         };
 
-        ArrayList<Widget *> widgets{};  ///< List of widgets on this page
+    private:
         StringView title;               ///< Page title displayed in header
+        bool layout_dirty{true};        ///< Whole page must be redrawn on next render
+
+    protected:
+        UI &context;                    ///< UI context this page belongs to
+        usize widgets_count{0};         ///< Number of widgets on this page
         usize cursor{0};                ///< Current widget cursor position (focused widget index)
-        PageSetter to_this{*this};      ///< Navigation widget to this page
+        usize first_visible{0};         ///< Index of widget in first slot at last full render
+        usize visible_count{0};         ///< Number of widget slots at last full render
+        PageLink to_this{*this};        ///< Navigation widget to this page
 
     public:
         /// @brief Construct page with title
+        /// @param context UI context page belongs to
         /// @param title Page title string
-        explicit Page(StringView title) :
-            title{title} {}
+        explicit BasicPage(UI &context, StringView title) :
+            title{title}, context{context} {}
+
+        /// @brief Construct page of default UI context
+        /// @param title Page title string
+        explicit BasicPage(StringView title) :
+            BasicPage{UI::instance(), title} {}
+
+        BasicPage(const BasicPage &) = delete;
 
         /// @brief Page behavior on entry
         virtual void onEntry() noexcept {}
@@ -123,34 +182,31 @@ template<typename R, typename E> struct UI final : Singleton<UI<R, E>> {
         /// @brief Page behavior on external update
         virtual void onUpdate(Milliseconds now) noexcept {}
 
-        /// @brief Add widget to this page
-        /// @param widget Widget to add (must remain valid for page lifetime)
-        void addWidget(Widget &widget) {
-            widgets.push_back(&widget);
-        }
+        /// @brief Poll widgets for externally driven changes
+        /// @return true if any widget was marked dirty
+        virtual bool scanChanges() noexcept = 0;
 
-        /// @brief Create bidirectional navigation link between pages
-        /// @param other Page to link with (adds navigation widgets to both pages)
-        void link(Page &other) {
-            this->addWidget(other.to_this);
-            other.addWidget(this->to_this);
+        /// @brief Request whole page redraw on next render
+        void invalidate() noexcept { layout_dirty = true; }
+
+        /// @brief Check if next render must redraw whole page
+        /// @return true if layout changed or focused widget left visible slots
+        kf_nodiscard bool fullRenderRequired() const noexcept {
+            return layout_dirty or cursor < first_visible or cursor >= first_visible + visible_count;
         }
 
         /// @brief Render page content to display
         /// @param render Renderer instance to use for drawing
-        /// @note Handles cursor positioning and widget focus
-        void render(RenderImpl &render) noexcept {
-            render.title(title);
-
-            const auto available = render.widgetsAvailable();
-            const auto start = (totalWidgets() > available) ? kf::min(cursor, totalWidgets() - available) : 0;
-            const auto end = kf::min(start + available, totalWidgets());
-
-            for (auto i = start; i < end; i += 1) {
-                render.beginWidget(i);
-                widgets[i]->render(render, i == cursor);
-                render.endWidget();
+        /// @param full Redraw title and all visible widgets, otherwise only dirty widgets are emitted into their slots
+        /// @note Visible window scrolls only when focused widget leaves it
+        void render(RenderImpl &render, bool full) noexcept {
+            if (full) {
+                render.title(title);
+                updateVisibleWindow(render.widgetsAvailable());
+                layout_dirty = false;
             }
+
+            renderSlots(render, full);
         }
 
         /// @brief Process incoming UI event
@@ -159,6 +215,7 @@ template<typename R, typename E> struct UI final : Singleton<UI<R, E>> {
         bool onEvent(Event event) noexcept {
             switch (event.type()) {
                 case Event::Type::Update: {
+                    invalidate();
                     return true;
                 }
                 case Event::Type::PageCursorMove: {
@@ -166,13 +223,15 @@ template<typename R, typename E> struct UI final : Singleton<UI<R, E>> {
                 }
                 case Event::Type::WidgetClick: {
                     if (totalWidgets() > 0) {
-                        return widgets[cursor]->onClick();
+                        return clickWidget(cursor);
                     }
+                    return false;
                 }
                 case Event::Type::WidgetValueChange: {
                     if (totalWidgets() > 0) {
-                        return widgets[cursor]->onValue(event.value());
+                        return changeWidget(cursor, event.value());
                     }
+                    return false;
                 }
             }
             return false;
@@ -180,7 +239,50 @@ template<typename R, typename E> struct UI final : Singleton<UI<R, E>> {
 
         /// @brief Get total widget count on page
         /// @return Number of widgets on this page
-        kf_nodiscard inline usize totalWidgets() const noexcept { return static_cast<int>(widgets.size()); }
+        kf_nodiscard inline usize totalWidgets() const noexcept { return widgets_count; }
+
+    protected:
+        /// @brief Emit visible widgets [first_visible, first_visible + visible_count) into their slots
+        /// @param full Emit all visible widgets, otherwise only dirty ones
+        virtual void renderSlots(RenderImpl &render, bool full) noexcept = 0;
+
+        /// @brief Forward click to widget
+        /// @return true if redraw required
+        virtual bool clickWidget(usize index) noexcept = 0;
+
+        /// @brief Forward value change to widget
+        /// @return true if redraw required
+        virtual bool changeWidget(usize index, EventValue value) noexcept = 0;
+
+        /// @brief Mark widget dirty
+        virtual void invalidateWidget(usize index) noexcept = 0;
+
+        /// @brief Emit widget into slot if it must be redrawn
+        /// @tparam W Widget type (final widget types are rendered without virtual dispatch)
+        template<typename W> void renderWidget(RenderImpl &render, W &widget, usize slot, bool focused, bool full) noexcept {
+            if (not full and not widget.dirty) { return; }
+
+            kf_UI_profile(context.profiler_state, widget(first_visible + slot));
+
+            render.beginWidget(slot);
+            if (focused) {
+                render.beginFocused();
+                widget.doRender(render);
+                render.endFocused();
+            } else {
+                widget.doRender(render);
+            }
+            render.endWidget();
+
+            widget.dirty = false;
+        }
+
+        /// @brief Mark widget dirty if its event handler requested redraw
+        /// @return changed
+        static bool markIfChanged(Widget &widget, bool changed) noexcept {
+            if (changed) { widget.invalidate(); }
+            return changed;
+        }
 
     private:
         /// @brief Get maximum cursor position (last widget index)
@@ -190,73 +292,577 @@ template<typename R, typename E> struct UI final : Singleton<UI<R, E>> {
         /// @brief Move cursor within page bounds
         /// @param delta Cursor movement delta (positive/negative)
         /// @return true if cursor position changed (redraw required)
+        /// @note Previously and newly focused widgets are marked dirty
         kf_nodiscard bool moveCursor(isize delta) noexcept {
             const auto n = totalWidgets();
             if (n > 1) {
-                cursor += delta;
-                cursor += n;
-                cursor %= n;
+                invalidateWidget(cursor);
+                // Signed wrap: coalesced delta may exceed widget count in either direction
+                const auto count = static_cast<isize>(n);
+                cursor = static_cast<usize>(((static_cast<isize>(cursor) + delta) % count + count) % count);
+                invalidateWidget(cursor);
                 return true;
             } else {
                 return false;
             }
         }
+
+        /// @brief Fit visible window to slot count keeping focused widget visible
+        /// @param available Number of widget slots provided by renderer
+        void updateVisibleWindow(usize available) noexcept {
+            const auto total = totalWidgets();
+            visible_count = kf::min(available, total);
+
+            if (visible_count == 0) {
+                first_visible = 0;
+                return;
+            }
+
+            if (cursor < first_visible) {
+                first_visible = cursor;
+            } else if (cursor >= first_visible + visible_count) {
+                first_visible = cursor + 1 - visible_count;
+            }
+
+            first_visible = kf::min(first_visible, total - visible_count);
+        }
+    };
+
+    using PageLink = typename BasicPage::PageLink;///< Page navigation widget
+
+    /// @brief UI page containing widgets and title
+    /// @note Widgets are added at runtime and dispatched through virtual calls
+    struct Page : BasicPage {
+    private:
+        Array<Widget *, P> widgets{};///< Widgets of this page, first widgets_count used
+
+    public:
+        /// @brief Construct page with title
+        /// @param context UI context page belongs to
+        /// @param title Page title string
+        explicit Page(UI &context, StringView title) :
+            BasicPage{context, title} {}
+
+        /// @brief Construct page of default UI context
+        /// @param title Page title string
+        explicit Page(StringView title) :
+            BasicPage{title} {}
+
+        /// @brief Add widget to this page
+        /// @param widget Widget to add (must remain valid for page lifetime)
+        /// @return false if page is full (widget is not added)
+        bool addWidget(Widget &widget) noexcept {
+            if (this->widgets_count >= P) { return false; }
+
+            widgets[this->widgets_count] = &widget;
+            this->widgets_count += 1;
+            this->invalidate();
+            return true;
+        }
+
+        /// @brief Create bidirectional navigation link between pages
+        /// @param other Page to link with (adds navigation widgets to both pages)
+        void link(Page &other) noexcept {
+            (void) this->addWidget(other.to_this);
+            (void) other.addWidget(this->to_this);
+        }
+
+        bool scanChanges() noexcept override {
+            bool changed{false};
+            for (usize i = 0; i < this->widgets_count; i += 1) {
+                changed |= this->markIfChanged(*widgets[i], widgets[i]->onPoll());
+            }
+            return changed;
+        }
+
+    protected:
+        void renderSlots(RenderImpl &render, bool full) noexcept override {
+            for (usize slot = 0; slot < this->visible_count; slot += 1) {
+                const auto index = this->first_visible + slot;
+                this->renderWidget(render, *widgets[index], slot, index == this->cursor, full);
+            }
+        }
+
+        bool clickWidget(usize index) noexcept override {
+            return this->markIfChanged(*widgets[index], widgets[index]->onClick());
+        }
+
+        bool changeWidget(usize index, EventValue value) noexcept override {
+            return this->markIfChanged(*widgets[index], widgets[index]->onValue(value));
+        }
+
+        void invalidateWidget(usize index) noexcept override { widgets[index]->invalidate(); }
+    };
+
+    /// @brief Statically typed page storing widgets by value in tuple
+    /// @tparam Ws Widget types (constructed without page)
+    /// @note Rendering is unrolled at compile time and events are routed through generated jump tables,
+    /// so widget handlers of final widget types are called directly and may be inlined
+    template<typename... Ws> struct StaticPage : BasicPage {
+        static_assert(sizeof...(Ws) >= 1, "StaticPage requires at least one widget");
+        static_assert((std::is_base_of<Widget, Ws>::value and ...), "Ws must be Widget Subclasses");
+
+        using Widgets = std::tuple<Ws...>;///< Widget storage type
+
+        Widgets widgets;///< Page widgets in display order
+
+        /// @brief Construct page with title and widgets
+        /// @param context UI context page belongs to
+        /// @param title Page title string
+        /// @param ws Widgets in display order
+        explicit StaticPage(UI &context, StringView title, Ws... ws) :
+            BasicPage{context, title}, widgets{std::move(ws)...} {
+            this->widgets_count = sizeof...(Ws);
+        }
+
+        /// @brief Construct page of default UI context with title and widgets
+        /// @param title Page title string
+        /// @param ws Widgets in display order
+        explicit StaticPage(StringView title, Ws... ws) :
+            StaticPage{UI::instance(), title, std::move(ws)...} {}
+
+        /// @brief Access widget by index
+        template<usize I> kf_nodiscard auto &get() noexcept { return std::get<I>(widgets); }
+
+        bool scanChanges() noexcept override {
+            return scanChangesImpl(std::index_sequence_for<Ws...>{});
+        }
+
+    protected:
+        void renderSlots(RenderImpl &render, bool full) noexcept override {
+            renderSlotsImpl(render, full, std::index_sequence_for<Ws...>{});
+        }
+
+        bool clickWidget(usize index) noexcept override {
+            return jump<Click>(index, 0, std::index_sequence_for<Ws...>{});
+        }
+
+        bool changeWidget(usize index, EventValue value) noexcept override {
+            return jump<Change>(index, value, std::index_sequence_for<Ws...>{});
+        }
+
+        void invalidateWidget(usize index) noexcept override {
+            (void) jump<Invalidate>(index, 0, std::index_sequence_for<Ws...>{});
+        }
+
+    private:
+        using Handler = bool (*)(StaticPage &, EventValue) noexcept;
+
+        template<usize I> struct Click {
+            static bool call(StaticPage &page, EventValue) noexcept {
+                auto &widget = std::get<I>(page.widgets);
+                return page.markIfChanged(widget, widget.onClick());
+            }
+        };
+
+        template<usize I> struct Change {
+            static bool call(StaticPage &page, EventValue value) noexcept {
+                auto &widget = std::get<I>(page.widgets);
+                return page.markIfChanged(widget, widget.onValue(value));
+            }
+        };
+
+        template<usize I> struct Invalidate {
+            static bool call(StaticPage &page, EventValue) noexcept {
+                std::get<I>(page.widgets).invalidate();
+                return true;
+            }
+        };
+
+        /// @brief Call Op<index> through table generated for all widget indices
+        template<template<usize> class Op, usize... I> bool jump(usize index, EventValue value, std::index_sequence<I...>) noexcept {
+            static constexpr Handler table[]{&Op<I>::call...};
+            return table[index](*this, value);
+        }
+
+        template<usize... I> void renderSlotsImpl(RenderImpl &render, bool full, std::index_sequence<I...>) noexcept {
+            (renderIfVisible<I>(render, full), ...);
+        }
+
+        template<usize I> void renderIfVisible(RenderImpl &render, bool full) noexcept {
+            if (I < this->first_visible or I >= this->first_visible + this->visible_count) { return; }
+            this->renderWidget(render, std::get<I>(widgets), I - this->first_visible, I == this->cursor, full);
+        }
+
+        template<usize... I> bool scanChangesImpl(std::index_sequence<I...>) noexcept {
+            bool changed{false};
+            ((changed |= this->markIfChanged(std::get<I>(widgets), std::get<I>(widgets).onPoll())), ...);
+            return changed;
+        }
+    };
+
+    /// @brief Virtualized list page rendering items through callbacks
+    /// @note Items are not widgets: memory use is constant and only visible rows are rendered,
+    /// regardless of item count. Page cursor and visible window act as list cursor and scroll position.
+    struct ListPage : BasicPage {
+        using ItemCount = Function<usize()>;                  ///< Provides current item count
+        using ItemRender = Function<void(RenderImpl &, usize)>;///< Renders item content by index
+        using ItemClick = Function<bool(usize)>;              ///< Handles click on item, returns true if redraw required
+        using ItemValue = Function<bool(usize, EventValue)>;  ///< Handles value change on item, returns true if redraw required
+
+        ItemCount item_count{nullptr};  ///< Item count source (polled every UI poll)
+        ItemRender item_render{nullptr};///< Item renderer
+        ItemClick on_click{nullptr};    ///< Item click handler
+        ItemValue on_value{nullptr};    ///< Item value change handler
+
+    private:
+        static constexpr usize tracked_slots{32};///< Slots with individual dirty tracking, further slots redraw with any change
+
+        u32 dirty_slots{0};///< Dirty flags of visible slots
+
+    public:
+        /// @brief Construct list page with title
+        /// @param context UI context page belongs to
+        /// @param title Page title string
+        explicit ListPage(UI &context, StringView title) :
+            BasicPage{context, title} {}
+
+        /// @brief Construct list page of default UI context
+        /// @param title Page title string
+        explicit ListPage(StringView title) :
+            BasicPage{title} {}
+
+        /// @brief Get focused item index
+        kf_nodiscard usize selected() const noexcept { return this->cursor; }
+
+        /// @brief Request redraw of single item (no-op if item is not visible)
+        void invalidateItem(usize index) noexcept { invalidateWidget(index); }
+
+        /// @brief Pick up item count changes
+        /// @return true if item count changed
+        bool scanChanges() noexcept override {
+            const usize count = item_count ? item_count() : 0;
+            if (count == this->widgets_count) { return false; }
+
+            this->widgets_count = count;
+            if (this->cursor >= count) {
+                this->cursor = (count > 0) ? count - 1 : 0;
+            }
+            this->invalidate();
+            return true;
+        }
+
+    protected:
+        void renderSlots(RenderImpl &render, bool full) noexcept override {
+            for (usize slot = 0; slot < this->visible_count; slot += 1) {
+                const bool tracked = slot < tracked_slots;
+                if (not full and tracked and not (dirty_slots & (u32{1} << slot))) { continue; }
+
+                const auto index = this->first_visible + slot;
+                render.beginWidget(slot);
+                if (index == this->cursor) {
+                    render.beginFocused();
+                    item_render(render, index);
+                    render.endFocused();
+                } else {
+                    item_render(render, index);
+                }
+                render.endWidget();
+            }
+            dirty_slots = 0;
+        }
+
+        bool clickWidget(usize index) noexcept override {
+            if (not on_click or not on_click(index)) { return false; }
+            invalidateWidget(index);
+            return true;
+        }
+
+        bool changeWidget(usize index, EventValue value) noexcept override {
+            if (not on_value or not on_value(index, value)) { return false; }
+            invalidateWidget(index);
+            return true;
+        }
+
+        void invalidateWidget(usize index) noexcept override {
+            if (index < this->first_visible) { return; }
+
+            const auto slot = index - this->first_visible;
+            if (slot < tracked_slots) {
+                dirty_slots |= u32{1} << slot;
+            }
+        }
+    };
+
+#if kf_UI_profiling
+    /// @brief Diagnostics page listing profiler entries as "name: min/mean/max"
+    struct ProfilerPage final : ListPage {
+        Milliseconds refresh_period{500};///< Minimal time between statistics redraws
+
+    private:
+        static constexpr usize fixed_entries{2 + Profiler::event_entries};
+        static constexpr usize total_entries{fixed_entries + Profiler::widget_entries};
+
+        Milliseconds last_refresh{0};
+        bool refresh_due{false};
+
+    public:
+        /// @brief Construct diagnostics page showing statistics of its context
+        /// @param context UI context page belongs to
+        /// @param title Page title string
+        explicit ProfilerPage(UI &context, StringView title) :
+            ListPage{context, title} {
+            this->item_count = [] { return total_entries; };
+            this->item_render = [this](RenderImpl &render, usize index) { renderEntry(render, index); };
+        }
+
+        /// @brief Construct diagnostics page of default UI context
+        /// @param title Page title string
+        explicit ProfilerPage(StringView title) :
+            ProfilerPage{UI::instance(), title} {}
+
+        void onUpdate(Milliseconds now) noexcept override {
+            if (now - last_refresh < refresh_period) { return; }
+            last_refresh = now;
+            refresh_due = true;
+        }
+
+        bool scanChanges() noexcept override {
+            const bool changed = ListPage::scanChanges();
+            if (not refresh_due) { return changed; }
+
+            refresh_due = false;
+            for (usize i = 0; i < this->visible_count; i += 1) {
+                this->invalidateItem(this->first_visible + i);
+            }
+            return true;
+        }
+
+    private:
+        void renderEntry(RenderImpl &render, usize index) const noexcept {
+            static_assert(Profiler::event_entries == 4, "Event type names must match Event::Type");
+            static constexpr StringView names[fixed_entries]{"poll", "frame", "update", "cursor", "click", "value"};
+
+            if (index < fixed_entries) {
+                render.value(names[index]);
+            } else {
+                render.value(StringView{"w"});
+                render.value(static_cast<i32>(index - fixed_entries));
+            }
+            render.colon();
+
+            const auto &stats = entry(index);
+            render.value(static_cast<i32>(stats.min));
+            render.value(StringView{"/"});
+            render.value(static_cast<i32>(stats.mean()));
+            render.value(StringView{"/"});
+            render.value(static_cast<i32>(stats.max));
+        }
+
+        kf_nodiscard const ui::TimingStats &entry(usize index) const noexcept {
+            const auto &source = this->context.profiler_state;
+            if (index == 0) { return source.polls; }
+            if (index == 1) { return source.frames; }
+            if (index < fixed_entries) { return source.events[index - 2]; }
+            return source.widgets[index - fixed_entries];
+        }
     };
+#endif
 
 private:
-    Queue<Event> events{};     ///< Event queue for pending UI events
-    Page *active_page{nullptr};///< Currently active page for rendering
-    RenderImpl render_system{};///< Renderer implementation instance
+    EventQueue events{};                 ///< Event queue for pending UI events
+    Event pending_event{Event::update()};///< Popped event accumulating following same-type events
+    bool has_pending_event{false};       ///< pending_event holds event to dispatch
+    bool pending_merged{false};          ///< pending_event holds sum of several events
+    DispatchBudget dispatch_budget{};    ///< Event dispatch limits per poll
+    Milliseconds frame_interval{0};      ///< Minimal time between rendered frames (0 - render on every change)
+    Milliseconds last_frame_time{0};     ///< Time of last rendered frame
+    bool render_pending{false};          ///< Changes not rendered yet
+    RenderStats render_stats{};          ///< Render scheduler counters
+#if kf_UI_profiling
+    Profiler profiler_state{};           ///< Timing collector
+#endif
+    BasicPage *active_page{nullptr};     ///< Currently active page for rendering
+    RenderImpl render_system{};          ///< Renderer implementation instance
 
 public:
+    /// @brief Construct independent UI context
+    explicit UI() = default;
+
+    UI(const UI &) = delete;
+
+    UI &operator=(const UI &) = delete;
+
+    /// @brief Get default UI context (used by pages constructed without context)
+    /// @note Created on first call
+    static UI &instance() noexcept {
+        static UI instance{};// NOLINT(*-dynamic-static-initializers)
+        return instance;
+    }
+
     /// @brief Access renderer configuration settings
     /// @return Reference to renderer settings structure
     RenderConfig &renderConfig() noexcept { return render_system.config; }
 
+    /// @brief Access renderer instance (renderer-specific controls)
+    /// @return Reference to renderer implementation
+    RenderImpl &renderer() noexcept { return render_system; }
+
+    /// @brief Access event dispatch limits
+    /// @return Reference to dispatch budget structure
+    DispatchBudget &dispatchBudget() noexcept { return dispatch_budget; }
+
+    /// @brief Limit render rate
+    /// @param rate Maximum frames per second (0 - render on every change)
+    /// @note Changes arriving between frames are accumulated and rendered together
+    void setFrameRate(Hertz rate) noexcept {
+        frame_interval = (rate > 0) ? static_cast<Milliseconds>(1000 / rate) : 0;
+    }
+
+    /// @brief Get render scheduler counters
+    kf_nodiscard const RenderStats &renderStats() const noexcept { return render_stats; }
+
+    /// @brief Reset render scheduler counters
+    void resetRenderStats() noexcept { render_stats = {}; }
+
+#if kf_UI_profiling
+    /// @brief Access timing collector (set its clock to start measuring)
+    Profiler &profiler() noexcept { return profiler_state; }
+#endif
+
+    /// @brief Render pending changes immediately regardless of frame rate limit
+    /// @note Use when caller has idle time to spare
+    void flushRender() noexcept {
+        if (nullptr == active_page or not render_pending) { return; }
+        renderFrame();
+    }
+
     /// @brief Set active page for display
     /// @param page Page to make active (must remain valid)
-    void bindPage(Page &page) noexcept {
+    void bindPage(BasicPage &page) noexcept {
         if (nullptr != active_page) {
             active_page->onExit();
         }
 
         active_page = &page;
+        active_page->invalidate();
         active_page->onEntry();
     }
 
     /// @brief Add event to processing queue
     /// @param event Event to queue for processing
-    void addEvent(Event event) {
-        events.push(event);
+    /// @return false if event was dropped by DropNewest overflow policy
+    /// @note Safe to call from single interrupt handler or other core concurrently with poll()
+    bool addEvent(Event event) noexcept {
+        return events.push(event.raw());
     }
 
+    /// @brief Set event queue overflow policy
+    /// @note Must be set before event producer starts
+    void setEventOverflowPolicy(OverflowPolicy policy) noexcept { events.overflow = policy; }
+
+    /// @brief Get number of events lost on queue overflow
+    kf_nodiscard u32 eventsDropped() const noexcept { return events.dropped(); }
+
+    /// @brief Get highest observed event queue size
+    kf_nodiscard usize eventsPeak() const noexcept { return events.peak(); }
+
     /// @brief Process active page update, pending events and render if needed
     /// @note Must be called regularly (e.g., in main loop)
+    /// @note Rendering is deferred until frame interval since last frame elapses
     void poll(Milliseconds now) noexcept {
         if (nullptr == active_page) { return; }
 
+        kf_UI_profile(profiler_state, polls);
+
         active_page->onUpdate(now);
 
-        if (events.empty()) { return; }
+        bool render_required = active_page->scanChanges();
+        if (not events.empty() or has_pending_event) {
+            render_required |= dispatchEvents();
+        }
+        render_pending |= render_required;
+
+        if (not render_pending) { return; }
+
+        if (now - last_frame_time < frame_interval) {
+            if (render_required) { render_stats.skipped += 1; }
+            return;
+        }
+
+        last_frame_time = now;
+        renderFrame();
+    }
+
+private:
+    /// @brief Render accumulated changes of active page
+    void renderFrame() noexcept {
+        kf_UI_profile(profiler_state, frames);
+
+        const bool full = active_page->fullRenderRequired() or not render_system.partial();
+        render_system.prepare(full);
+        active_page->render(render_system, full);
+        render_system.finish();
+
+        render_pending = false;
+        render_stats.performed += 1;
+    }
 
-        constexpr usize max_events_per_poll{20};
-        usize events_processed{0};
+    /// @brief Dispatch queued events to active page within dispatch budget
+    /// @return true if redraw required
+    /// @note Consecutive same-type value events are coalesced (see Event::merge),
+    /// event taken from queue but not dispatched due to budget stays pending for next poll
+    bool dispatchEvents() noexcept {
+        const bool timed = dispatch_budget.max_time > 0 and dispatch_budget.clock;
+        const Microseconds start = timed ? dispatch_budget.clock() : 0;
 
         bool render_required{false};
+        usize dispatched{0};
+
+        // At most one queue capacity per poll so producer flood cannot stall caller
+        for (usize taken = 0; taken < EventQueue::capacity() and not budgetExhausted(dispatched, timed, start); taken += 1) {
+            const auto raw = events.pop();
+            if (not raw.hasValue()) { break; }
+
+            const auto event = Event::fromRaw(raw.valueOr(0));
+
+            if (has_pending_event) {
+                if (pending_event.merge(event)) {
+                    pending_merged = true;
+                    continue;
+                }
 
-        while (not events.empty() and events_processed < max_events_per_poll) {
-            render_required |= active_page->onEvent(events.front());
-            events_processed += 1;
-            events.pop();
+                render_required |= dispatchPendingEvent();
+                dispatched += 1;
+            }
+
+            pending_event = event;
+            has_pending_event = true;
+            pending_merged = false;
         }
 
-        if (render_required) {
-            render_system.prepare();
-            active_page->render(render_system);
-            render_system.finish();
+        if (has_pending_event and not budgetExhausted(dispatched, timed, start)) {
+            render_required |= dispatchPendingEvent();
+            has_pending_event = false;
         }
+
+        return render_required;
+    }
+
+    /// @brief Dispatch pending event unless its merged steps cancel out
+    /// @return true if redraw required
+    bool dispatchPendingEvent() noexcept {
+        if (pending_merged and pending_event.value() == 0) { return false; }
+        return dispatchEvent(pending_event);
+    }
+
+    /// @brief Route event to active page
+    /// @return true if redraw required
+    bool dispatchEvent(Event event) noexcept {
+        kf_UI_profile(profiler_state, event(static_cast<usize>(event.type()) >> Event::value_bits));
+        return active_page->onEvent(event);
     }
 
+    /// @brief Check if dispatch budget of current poll is spent
+    /// @param dispatched Events dispatched so far
+    /// @param timed Time budget is active
+    /// @param start Dispatch start time
+    kf_nodiscard bool budgetExhausted(usize dispatched, bool timed, Microseconds start) const noexcept {
+        if (dispatched >= dispatch_budget.max_events) { return true; }
+        return timed and dispatch_budget.clock() - start >= dispatch_budget.max_time;
+    }
+
+public:
     // Helpful components
 
     template<typename T> struct HasChangeHandler {
@@ -289,6 +895,11 @@ public:
         explicit Button(Page &root, StringView label) :
             Widget{root}, label{label} {}
 
+        /// @brief Construct button with label (not attached to page)
+        /// @param label Button display text
+        explicit Button(StringView label) :
+            label{label} {}
+
         /// @brief Handle button click event
         /// @return false (button click typically doesn't require redraw)
         bool onClick() noexcept override {
@@ -410,14 +1021,15 @@ public:
         /// @brief Move selection cursor with circular wrapping
         /// @param delta Cursor movement delta
         void moveCursor(int delta) noexcept {
-            cursor += delta;
-            cursor += N;
-            cursor %= N;
+            // Signed wrap: coalesced delta may exceed item count in either direction
+            constexpr auto count = static_cast<int>(N);
+            cursor = ((cursor + delta) % count + count) % count;
         }
     };
 
     /// @brief Display widget for showing read-only values
     /// @tparam T Type of value to display
+    /// @note Redrawn only with whole page, use LiveDisplay for changing values
     template<typename T> struct Display final : Widget {
     private:
         const T &value;///< Reference to value to display
@@ -441,6 +1053,58 @@ public:
         }
     };
 
+    /// @brief Default LiveDisplay equality: within tolerance for arithmetic types, operator== otherwise
+    template<typename T> struct LiveEqual {
+        T tolerance{};///< Maximal difference treated as equal (arithmetic types only)
+
+        kf_nodiscard bool operator()(const T &a, const T &b) const noexcept {
+            kf_if_constexpr (std::is_arithmetic<T>::value) {
+                return ((a > b) ? a - b : b - a) <= tolerance;
+            } else {
+                return a == b;
+            }
+        }
+    };
+
+    /// @brief Display widget tracking changes of observed value
+    /// @tparam T Type of value to display (copyable)
+    /// @tparam Equal Equality predicate deciding if value changed since last render
+    /// @note Redrawn only when observed value changes, no update events required for live data
+    template<typename T, typename Equal = LiveEqual<T>> struct LiveDisplay final : Widget {
+    private:
+        const T &value;///< Reference to observed value
+        T shown;       ///< Snapshot of value being displayed
+        Equal equal;   ///< Change predicate
+
+    public:
+        /// @brief Construct live display widget and add to page
+        /// @param root Page to add display to
+        /// @param val Value to observe (read-only reference)
+        /// @param equal Equality predicate (e.g. LiveEqual<f32>{0.01f})
+        explicit LiveDisplay(Page &root, const T &val, Equal equal = Equal{}) :
+            Widget{root}, value{val}, shown{val}, equal{equal} {}
+
+        /// @brief Construct live display widget (not attached to page)
+        /// @param val Value to observe (read-only reference)
+        /// @param equal Equality predicate
+        explicit LiveDisplay(const T &val, Equal equal = Equal{}) :
+            value{val}, shown{val}, equal{equal} {}
+
+        /// @brief Take snapshot of observed value if it changed
+        /// @return true if value changed since last snapshot
+        bool onPoll() noexcept override {
+            if (equal(value, shown)) { return false; }
+            shown = value;
+            return true;
+        }
+
+        /// @brief Render value snapshot
+        /// @param render Renderer instance
+        void doRender(RenderImpl &render) const noexcept override {
+            render.value(shown);
+        }
+    };
+
     /// @brief Widget wrapper adding label to another widget
     /// @tparam W Type of widget being labeled (must inherit from Widget)
     template<typename W> struct Labeled final : Widget {
@@ -461,6 +1125,12 @@ public:
         explicit Labeled(Page &root, StringView label, W impl) :
             Widget{root}, label{label}, impl{std::move(impl)} {}
 
+        /// @brief Construct labeled widget (not attached to page)
+        /// @param label Text label for widget
+        /// @param impl Widget to wrap with label
+        explicit Labeled(StringView label, W impl) :
+            label{label}, impl{std::move(impl)} {}
+
         /// @brief Forward click event to wrapped widget
         /// @return Result from wrapped widget's onClick()
         bool onClick() noexcept override { return impl.onClick(); }
@@ -470,6 +1140,10 @@ public:
         /// @return Result from wrapped widget's onValue()
         bool onValue(EventValue value) noexcept override { return impl.onValue(value); }
 
+        /// @brief Forward poll to wrapped widget
+        /// @return Result from wrapped widget's onPoll()
+        bool onPoll() noexcept override { return impl.onPoll(); }
+
         /// @brief Render label followed by wrapped widget
         /// @param render Renderer instance
         void doRender(RenderImpl &render) const noexcept override {
@@ -559,10 +1233,13 @@ public:
         /// @param direction Adjustment direction (positive/negative)
         void changeValue(int direction) noexcept {
             if (mode == Mode::Geometric) {
-                if (direction > 0) {
-                    value *= step;
-                } else {
-                    value /= step;
+                // One multiplication per step, coalesced events carry several steps
+                for (int i = 0; i < kf::abs(direction); i += 1) {
+                    if (direction > 0) {
+                        value *= step;
+                    } else {
+                        value /= step;
+                    }
                 }
             } else {
                 value += direction * step;
@@ -579,13 +1256,15 @@ public:
         void changeStep(int direction) noexcept {
             constexpr T step_multiplier{static_cast<T>(10)};
 
-            if (direction > 0) {
-                step *= step_multiplier;
-            } else {
-                step /= step_multiplier;
+            for (int i = 0; i < kf::abs(direction); i += 1) {
+                if (direction > 0) {
+                    step *= step_multiplier;
+                } else {
+                    step /= step_multiplier;
 
-                kf_if_constexpr (std::is_integral<T>::value) {
-                    if (step < 1) { step = 1; }
+                    kf_if_constexpr (std::is_integral<T>::value) {
+                        if (step < 1) { step = 1; }
+                    }
                 }
             }
         }
@@ -12,6 +12,7 @@ using std::find;
 using std::for_each;
 using std::max;
 using std::min;
+using std::sort;
 using std::abs;
 
 /// Constrain value between lower and upper bounds
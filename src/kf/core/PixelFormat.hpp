@@ -10,8 +10,9 @@ namespace kf {
 
 /// @brief Pixel format enumeration
 enum class PixelFormat : u8 {
-    Monochrome,///< 1-bit monochrome format (1 bit per pixel)
-    RGB565,    ///< 16-bit BIG ENDIAN RGB565 format (5-6-5 bits per channel)
+    Monochrome,        ///< 1-bit monochrome format (1 bit per pixel)
+    RGB565,            ///< 16-bit BIG ENDIAN RGB565 format (5-6-5 bits per channel)
+    MonochromeRowMajor,///< 1-bit monochrome format, row-major bytes (MSB is leftmost pixel)
 };
 
 }// namespace kf
\ No newline at end of file
@@ -28,3 +28,20 @@
 #else
 #define kf_deprecated(msg)
 #endif
+
+
+/// @brief Check if evaluated in constant expression (runtime-only fast paths branch on it)
+/// @note Without compiler support always true: constexpr code path is used everywhere
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated)
+#define kf_is_constant_evaluated() __builtin_is_constant_evaluated()
+#endif
+#endif
+
+#if not defined(kf_is_constant_evaluated) and defined(__GNUC__) and not defined(__clang__) and __GNUC__ >= 9
+#define kf_is_constant_evaluated() __builtin_is_constant_evaluated()
+#endif
+
+#if not defined(kf_is_constant_evaluated)
+#define kf_is_constant_evaluated() true
+#endif
\ No newline at end of file
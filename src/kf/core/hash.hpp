@@ -0,0 +1,31 @@
+// Copyright (c) 2026 KiraFlux
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "kf/aliases.hpp"
+#include "kf/core/attributes.hpp"
+#include "kf/memory/StringView.hpp"
+
+
+namespace kf {
+
+/// @brief FNV-1a 32-bit offset basis
+constexpr u32 fnv1a_basis{2166136261u};
+
+/// @brief FNV-1a 32-bit prime
+constexpr u32 fnv1a_prime{16777619u};
+
+/// @brief FNV-1a 32-bit hash of string
+/// @param str String to hash
+/// @param basis Initial value (chain hashes by passing previous result)
+/// @note constexpr: usable for switch labels and compile-time tables
+kf_nodiscard constexpr u32 fnv1a(StringView str, u32 basis = fnv1a_basis) noexcept {
+    u32 h = basis;
+    for (const char ch: str) {
+        h = (h ^ static_cast<u8>(ch)) * fnv1a_prime;
+    }
+    return h;
+}
+
+}// namespace kf
\ No newline at end of file
@@ -0,0 +1,158 @@
+// Copyright (c) 2026 KiraFlux
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <limits>
+
+#include "kf/aliases.hpp"
+#include "kf/core/attributes.hpp"
+
+
+namespace kf {
+
+/// @brief Maximum characters of formatted 32-bit integer (sign and 10 digits)
+constexpr usize max_integer_chars{11};
+
+/// @brief Maximum characters of formatted 32-bit hexadecimal integer
+constexpr usize max_hex_chars{8};
+
+/// @brief Two-digit decimal strings "00".."99"
+constexpr char decimal_digit_pairs[201]{
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899"
+};
+
+/// @brief Count decimal digits of value
+kf_nodiscard constexpr u8 decimalDigits(u32 value) noexcept {
+    u8 digits = 1;
+    while (value >= 10000) {
+        value /= 10000;
+        digits += 4;
+    }
+    if (value >= 1000) { return digits + 3; }
+    if (value >= 100) { return digits + 2; }
+    if (value >= 10) { return digits + 1; }
+    return digits;
+}
+
+/// @brief Write unsigned integer in decimal
+/// @param out Destination (at least max_integer_chars)
+/// @return Characters written
+constexpr usize formatUnsigned(char *out, u32 value) noexcept {
+    const usize length = decimalDigits(value);
+    usize position = length;
+
+    // Two digits per division
+    while (value >= 100) {
+        const auto pair = (value % 100) * 2;
+        value /= 100;
+        position -= 2;
+        out[position] = decimal_digit_pairs[pair];
+        out[position + 1] = decimal_digit_pairs[pair + 1];
+    }
+
+    if (value >= 10) {
+        out[0] = decimal_digit_pairs[value * 2];
+        out[1] = decimal_digit_pairs[value * 2 + 1];
+    } else {
+        out[0] = static_cast<char>('0' + value);
+    }
+    return length;
+}
+
+/// @brief Write signed integer in decimal
+/// @param out Destination (at least max_integer_chars)
+/// @return Characters written
+constexpr usize formatSigned(char *out, i32 value) noexcept {
+    if (value >= 0) { return formatUnsigned(out, static_cast<u32>(value)); }
+
+    out[0] = '-';
+    // Negation in unsigned arithmetic covers minimal value
+    return 1 + formatUnsigned(out + 1, 0u - static_cast<u32>(value));
+}
+
+/// @brief Write unsigned integer in hexadecimal (no prefix)
+/// @param out Destination (at least max_hex_chars)
+/// @param upper Use upper case digits
+/// @return Characters written
+constexpr usize formatHex(char *out, u32 value, bool upper = false) noexcept {
+    const char *digits = upper ? "0123456789ABCDEF" : "0123456789abcdef";
+
+    usize length = 1;
+    for (u32 rest = value >> 4; rest != 0; rest >>= 4) { length += 1; }
+
+    for (usize i = length; i > 0; i -= 1) {
+        out[i - 1] = digits[value & 0xF];
+        value >>= 4;
+    }
+    return length;
+}
+
+/// @brief Write fraction digits of real number (digits after decimal point, sign is ignored)
+/// @param out Destination (at least places)
+/// @param value Number to take fraction from
+/// @param places Maximal fraction digits (digits are truncated, trailing digits stop once fraction is exhausted)
+/// @return Characters written (0 for nan and inf)
+/// @note Integer part must fit into i32. Uses no libm or printf.
+inline usize formatFraction(char *out, f64 value, u8 places) noexcept {
+    if (not(value - value == 0)) { return 0; }// nan or inf
+    if (value < 0) { value = -value; }
+
+    usize length = 0;
+    f64 fraction = value - static_cast<i32>(value);
+    for (u8 i = 0; i < places; i += 1) {
+        fraction *= 10.0;
+        const auto digit = static_cast<u8>(fraction);
+        out[length++] = static_cast<char>('0' + digit);
+        fraction -= digit;
+
+        if (fraction < 1e-12) { break; }// Avoid floating point issues
+    }
+    return length;
+}
+
+/// @brief Write real number with up to places fraction digits
+/// @param out Destination (at least max_integer_chars + 2 + places)
+/// @param value Number to write
+/// @param places Maximal fraction digits (digits are truncated, trailing digits stop once fraction is exhausted)
+/// @return Characters written
+/// @note Integer part must fit into i32. Uses no libm or printf.
+inline usize formatFixed(char *out, f64 value, u8 places) noexcept {
+    usize length = 0;
+
+    if (value != value) {
+        out[0] = 'n', out[1] = 'a', out[2] = 'n';
+        return 3;
+    }
+
+    if (value > std::numeric_limits<f64>::max() or value < -std::numeric_limits<f64>::max()) {
+        if (value < 0) { out[length++] = '-'; }
+        out[length++] = 'i', out[length++] = 'n', out[length++] = 'f';
+        return length;
+    }
+
+    if (value < 0) {
+        out[length++] = '-';
+        value = -value;
+    }
+
+    const auto int_part = static_cast<i32>(value);
+    length += formatSigned(out + length, int_part);
+
+    if (places > 0) {
+        out[length++] = '.';
+        length += formatFraction(out + length, value, places);
+    }
+    return length;
+}
+
+}// namespace kf
\ No newline at end of file
@@ -31,6 +31,14 @@ template<> struct pixel_traits<PixelFormat::Monochrome> {
     /// @return Number of 8-pixel memory pages
     template<usize H> static constexpr usize pages = (H + 7) / 8;
 
+    /// @brief Row count alignment for partial (band) buffers
+    static constexpr u8 row_alignment = page_height;
+
+    /// @brief Calculate buffer size for runtime dimensions
+    static constexpr usize itemsFor(Pixel width, Pixel height) noexcept {
+        return static_cast<usize>(width) * ((static_cast<usize>(height) + 7) / 8);
+    }
+
     static constexpr ColorType fromRgb(u8 r, u8 b, u8 g) noexcept {
         return (r + g + b) > 128 * 3;
     }
@@ -154,6 +162,101 @@ template<> struct pixel_traits<PixelFormat::Monochrome> {
         }
     }
 
+    /// @brief Draw font glyph columns followed by one spacing row
+    /// @param columns Glyph column bytes (bit 0 is top pixel)
+    /// @param width Glyph width in columns
+    /// @param height Glyph height in rows (1..8), spacing row is drawn below
+    static void glyph(
+        BufferType *buffer,
+        Pixel stride,
+        Pixel abs_x,
+        Pixel abs_y,
+        const u8 *columns,
+        u8 width,
+        u8 height,
+        ColorType on,
+        ColorType off
+    ) noexcept {
+        const auto page = static_cast<Pixel>(abs_y / page_height);
+        const auto shift = static_cast<u8>(abs_y % page_height);
+        const auto glyph_mask = static_cast<u16>((1 << height) - 1);
+        const auto cell_mask = static_cast<u16>(((1 << (height + 1)) - 1) << shift);
+
+        BufferType *upper = buffer + page * stride + abs_x;
+        BufferType *lower = upper + stride;
+        const bool has_lower = (cell_mask >> page_height) != 0;
+
+        for (u8 col = 0; col < width; col += 1) {
+            const auto set = static_cast<u16>((columns[col] & glyph_mask) << shift);
+            auto bits = static_cast<u16>((on ? set : 0) | (off ? ~set : 0));
+            bits &= cell_mask;
+
+            upper[col] = static_cast<u8>((upper[col] & ~cell_mask) | bits);
+            if (has_lower) {
+                lower[col] = static_cast<u8>((lower[col] & ~(cell_mask >> page_height)) | (bits >> page_height));
+            }
+        }
+    }
+
+
+    /// @brief Draw line between two points (both inclusive) with Bresenham stepping
+    /// @details Mostly-horizontal lines walk the page byte pointer and row bit index,
+    /// mostly-vertical lines are drawn per pixel
+    static void line(
+        BufferType *buffer,
+        Pixel stride,
+        Pixel x0,
+        Pixel y0,
+        Pixel x1,
+        Pixel y1,
+        ColorType on
+    ) noexcept {
+        const int dx = (x1 > x0) ? x1 - x0 : x0 - x1;
+        const int dy = (y1 > y0) ? y1 - y0 : y0 - y1;
+        const int sx = (x0 < x1) ? 1 : -1;
+        const int sy = (y0 < y1) ? 1 : -1;
+        if (dx < dy) {
+            // Per-pixel writes: gathering a column's bits per page byte measured slower
+            int error = dy / 2;
+
+            for (int remaining = dy;; remaining -= 1) {
+                setPixel(buffer, stride, x0, y0, on);
+                if (remaining == 0) { return; }
+
+                y0 = static_cast<Pixel>(y0 + sy);
+                error -= dx;
+                if (error < 0) {
+                    error += dy;
+                    x0 = static_cast<Pixel>(x0 + sx);
+                }
+            }
+        }
+
+        const int page_step = sy * stride;
+        const u8 fill_byte = on ? 0xFF : 0x00;
+
+        BufferType *p = buffer + (y0 / page_height) * stride + x0;
+        int bit = y0 % page_height;
+        int error = dx / 2;
+
+        for (int remaining = dx;; remaining -= 1) {
+            const auto mask = static_cast<u8>(1 << bit);
+            *p = static_cast<u8>((*p & ~mask) | (fill_byte & mask));
+            if (remaining == 0) { return; }
+
+            p += sx;
+            error -= dy;
+            if (error < 0) {
+                error += dx;
+                bit += sy;
+                if (bit & ~(page_height - 1)) {
+                    bit &= page_height - 1;
+                    p += page_step;
+                }
+            }
+        }
+    }
+
 private:
     /// @brief Calculate page mask for specified region
     /// @return Bit mask for the visible portion of the page
@@ -194,6 +297,14 @@ template<> struct pixel_traits<PixelFormat::RGB565> {
     /// @return Required buffer size in elements (W * H)
     template<usize W, usize H> static constexpr usize buffer_size = W * H;
 
+    /// @brief Row count alignment for partial (band) buffers
+    static constexpr u8 row_alignment = 1;
+
+    /// @brief Calculate buffer size for runtime dimensions
+    static constexpr usize itemsFor(Pixel width, Pixel height) noexcept {
+        return static_cast<usize>(width) * static_cast<usize>(height);
+    }
+
     static constexpr ColorType fromRgb(u8 r, u8 g, u8 b) noexcept {
         const auto color = (r >> 3) << 11 | ((g >> 2) << 5) | (b >> 3);
         // convert to BE
@@ -274,6 +385,358 @@ template<> struct pixel_traits<PixelFormat::RGB565> {
             }
         }
     }
+
+    /// @brief Draw font glyph columns followed by one spacing row
+    /// @param columns Glyph column bytes (bit 0 is top pixel)
+    /// @param width Glyph width in columns
+    /// @param height Glyph height in rows (1..8), spacing row is drawn below
+    static void glyph(
+        BufferType *buffer,
+        Pixel stride,
+        Pixel abs_x,
+        Pixel abs_y,
+        const u8 *columns,
+        u8 width,
+        u8 height,
+        ColorType on,
+        ColorType off
+    ) noexcept {
+        BufferType *row = buffer + abs_y * stride + abs_x;
+
+        for (u8 y = 0; y < height; y += 1) {
+            const auto bit = static_cast<u8>(1 << y);
+            for (u8 x = 0; x < width; x += 1) {
+                row[x] = (columns[x] & bit) ? on : off;
+            }
+            row += stride;
+        }
+
+        for (u8 x = 0; x < width; x += 1) {
+            row[x] = off;
+        }
+    }
+
+    /// @brief Draw line between two points (both inclusive) with Bresenham stepping
+    /// @details Walks a single buffer pointer, no per-pixel index computation
+    static void line(
+        BufferType *buffer,
+        Pixel stride,
+        Pixel x0,
+        Pixel y0,
+        Pixel x1,
+        Pixel y1,
+        ColorType color
+    ) noexcept {
+        const int dx = (x1 > x0) ? x1 - x0 : x0 - x1;
+        const int dy = (y1 > y0) ? y1 - y0 : y0 - y1;
+        const int step_x = (x0 < x1) ? 1 : -1;
+        const int step_y = (y0 < y1) ? stride : -stride;
+
+        // Major axis advances every pixel, minor axis on error underflow
+        const int major = (dx >= dy) ? dx : dy;
+        const int minor = (dx >= dy) ? dy : dx;
+        const int major_step = (dx >= dy) ? step_x : step_y;
+        const int minor_step = (dx >= dy) ? step_y : step_x;
+
+        BufferType *p = buffer + y0 * stride + x0;
+        int error = major / 2;
+
+        for (int i = 0;; i += 1) {
+            *p = color;
+            if (i == major) { return; }
+
+            // Branchless minor step: slope is data-dependent, a branch here mispredicts
+            error -= minor;
+            const int underflow = -static_cast<int>(error < 0);
+            error += major & underflow;
+            p += major_step + (minor_step & underflow);
+        }
+    }
+};
+
+/// @brief Row-major monochrome pixel format traits (1 bit per pixel)
+/// @details Each buffer row holds ceil(width / 8) bytes, leftmost pixel in MSB.
+/// Matches memory LCD and ST7920 style panels, so the buffer can be streamed as-is
+template<> struct pixel_traits<PixelFormat::MonochromeRowMajor> {
+    using BufferType = u8; ///< Buffer element type (uint8_t)
+    using ColorType = bool;///< Color representation type (bool)
+
+    static constexpr u8 bits_per_pixel = 1;///< Bits per pixel
+    static constexpr u8 pixels_per_byte = 8;///< Horizontal pixels per buffer byte
+
+    /// @brief Calculate bytes per buffer row for given width
+    template<usize W> static constexpr usize row_bytes = (W + 7) / 8;
+
+    /// @brief Calculate buffer size for given dimensions
+    template<usize W, usize H> static constexpr usize buffer_size = row_bytes<W> * H;
+
+    /// @brief Row count alignment for partial (band) buffers
+    static constexpr u8 row_alignment = 1;
+
+    static constexpr ColorType fromRgb(u8 r, u8 b, u8 g) noexcept {
+        return (r + g + b) > 128 * 3;
+    }
+
+    /// @brief Bytes per row for runtime stride in pixels
+    static constexpr usize rowBytes(Pixel stride) noexcept {
+        return (static_cast<usize>(stride) + 7) / 8;
+    }
+
+    /// @brief Calculate buffer size for runtime dimensions
+    static constexpr usize itemsFor(Pixel width, Pixel height) noexcept {
+        return rowBytes(width) * static_cast<usize>(height);
+    }
+
+    /// @brief Set pixel value in monochrome buffer
+    static void setPixel(
+        BufferType *buffer,
+        Pixel stride,
+        Pixel abs_x,
+        Pixel abs_y,
+        ColorType on
+    ) noexcept {
+        const usize index = abs_y * rowBytes(stride) + (abs_x >> 3);
+        const auto bit_mask = static_cast<u8>(0x80 >> (abs_x & 7));
+
+        if (on) {
+            buffer[index] |= bit_mask;
+        } else {
+            buffer[index] &= ~bit_mask;
+        }
+    }
+
+    /// @brief Fill rectangular region with specified value
+    static void fill(
+        BufferType *buffer,
+        Pixel stride,
+        Pixel offset_x,
+        Pixel offset_y,
+        Pixel width,
+        Pixel height,
+        ColorType value
+    ) noexcept {
+        const auto x0 = kf::max<Pixel>(offset_x, 0);
+        const auto x1 = kf::min<Pixel>(static_cast<Pixel>(offset_x + width), stride);// exclusive
+        if (x0 >= x1 or height <= 0) { return; }
+
+        const usize bytes_per_row = rowBytes(stride);
+        const auto first_byte = static_cast<usize>(x0 >> 3);
+        const auto last_byte = static_cast<usize>((x1 - 1) >> 3);
+        const auto head_mask = static_cast<u8>(0xFF >> (x0 & 7));
+        const auto tail_mask = static_cast<u8>(0xFF << (7 - ((x1 - 1) & 7)));
+        const u8 fill_byte = value ? 0xFF : 0x00;
+
+        BufferType *row = buffer + offset_y * bytes_per_row;
+
+        for (Pixel y = 0; y < height; y += 1) {
+            if (first_byte == last_byte) {
+                writeMasked(row[first_byte], head_mask & tail_mask, fill_byte);
+            } else {
+                writeMasked(row[first_byte], head_mask, fill_byte);
+                for (usize i = first_byte + 1; i < last_byte; i += 1) {
+                    row[i] = fill_byte;
+                }
+                writeMasked(row[last_byte], tail_mask, fill_byte);
+            }
+            row += bytes_per_row;
+        }
+    }
+
+    /// @brief Copy rectangular region from source to destination buffer
+    static void copy(
+        const BufferType *source_buffer,
+        Pixel source_width,
+        Pixel source_height,
+        BufferType *dest_buffer,
+        Pixel dest_stride,
+        Pixel dest_width,
+        Pixel dest_height,
+        Pixel dest_x,
+        Pixel dest_y
+    ) noexcept {
+
+        // Boundary checks
+        if (dest_x >= dest_width or dest_y >= dest_height) { return; }
+
+        int copy_width = source_width;
+        int copy_height = source_height;
+
+        if (dest_x + copy_width > dest_width) {
+            copy_width = dest_width - dest_x;
+        }
+        if (dest_y + copy_height > dest_height) {
+            copy_height = dest_height - dest_y;
+        }
+
+        if (copy_width <= 0 or copy_height <= 0) { return; }
+
+        const usize src_row_bytes = rowBytes(source_width);
+        const usize dest_row_bytes = rowBytes(dest_stride);
+        const auto end_x = dest_x + copy_width;// exclusive
+        const auto first_byte = dest_x >> 3;
+        const auto last_byte = (end_x - 1) >> 3;
+
+        for (auto y = 0; y < copy_height; y += 1) {
+            const BufferType *src_row = source_buffer + y * src_row_bytes;
+            BufferType *dest_row = dest_buffer + (dest_y + y) * dest_row_bytes;
+
+            for (auto b = first_byte; b <= last_byte; b += 1) {
+                const auto byte_x = b * pixels_per_byte;
+                const auto lo = kf::max(byte_x, static_cast<int>(dest_x));
+                const auto hi = kf::min(byte_x + pixels_per_byte, end_x);
+                const auto mask = static_cast<u8>((0xFF >> (lo - byte_x)) & (0xFF << (byte_x + pixels_per_byte - hi)));
+
+                writeMasked(dest_row[b], mask, fetchByte(src_row, src_row_bytes, byte_x - dest_x));
+            }
+        }
+    }
+
+    /// @brief Draw font glyph columns followed by one spacing row
+    /// @param columns Glyph column bytes (bit 0 is top pixel)
+    /// @param width Glyph width in columns
+    /// @param height Glyph height in rows (1..8), spacing row is drawn below
+    static void glyph(
+        BufferType *buffer,
+        Pixel stride,
+        Pixel abs_x,
+        Pixel abs_y,
+        const u8 *columns,
+        u8 width,
+        u8 height,
+        ColorType on,
+        ColorType off
+    ) noexcept {
+        if (width > pixels_per_byte) {
+            glyph(buffer, stride, static_cast<Pixel>(abs_x + pixels_per_byte), abs_y,
+                  columns + pixels_per_byte, static_cast<u8>(width - pixels_per_byte), height, on, off);
+            width = pixels_per_byte;
+        }
+
+        const usize bytes_per_row = rowBytes(stride);
+        const auto first_byte = static_cast<usize>(abs_x >> 3);
+        const auto shift = static_cast<u8>(abs_x & 7);
+        const auto cell_mask = static_cast<u16>(static_cast<u16>(0xFFFF << (16 - width)) >> shift);
+
+        BufferType *row = buffer + abs_y * bytes_per_row + first_byte;
+        const bool has_second = (cell_mask & 0xFF) != 0;
+
+        for (u8 y = 0; y <= height; y += 1) {
+            // Transpose one glyph row into MSB-first bits
+            u16 set = 0;
+            if (y < height) {
+                for (u8 x = 0; x < width; x += 1) {
+                    set |= static_cast<u16>(((columns[x] >> y) & 1) << (15 - x));
+                }
+                set = static_cast<u16>(set >> shift);
+            }
+
+            const auto bits = static_cast<u16>(((on ? set : 0) | (off ? ~set : 0)) & cell_mask);
+            writeMasked(row[0], static_cast<u8>(cell_mask >> 8), static_cast<u8>(bits >> 8));
+            if (has_second) {
+                writeMasked(row[1], static_cast<u8>(cell_mask), static_cast<u8>(bits));
+            }
+            row += bytes_per_row;
+        }
+    }
+
+    /// @brief Draw line between two points (both inclusive) with Bresenham stepping
+    /// @details Mostly-horizontal lines accumulate each row span's bits and store once per byte,
+    /// mostly-vertical lines are drawn per pixel
+    static void line(
+        BufferType *buffer,
+        Pixel stride,
+        Pixel x0,
+        Pixel y0,
+        Pixel x1,
+        Pixel y1,
+        ColorType on
+    ) noexcept {
+        const int dx = (x1 > x0) ? x1 - x0 : x0 - x1;
+        const int dy = (y1 > y0) ? y1 - y0 : y0 - y1;
+        const auto bytes_per_row = static_cast<int>(rowBytes(stride));
+
+        if (dx >= dy) {
+            if (x0 > x1) {
+                std::swap(x0, x1);
+                std::swap(y0, y1);
+            }
+
+            const int row_step = (y0 < y1) ? bytes_per_row : -bytes_per_row;
+            BufferType *p = buffer + y0 * bytes_per_row + (x0 >> 3);
+            u8 bits = 0;
+            int error = dx / 2;
+
+            for (int x = x0;; x += 1) {
+                bits |= static_cast<u8>(0x80 >> (x & 7));
+                if (x == x1) {
+                    writeBits(*p, bits, on);
+                    return;
+                }
+
+                error -= dy;
+                const bool step_y = error < 0;
+                const bool next_byte = ((x + 1) & 7) == 0;
+
+                if (step_y or next_byte) {
+                    writeBits(*p, bits, on);
+                    bits = 0;
+                }
+                if (step_y) {
+                    error += dx;
+                    p += row_step;
+                }
+                if (next_byte) {
+                    p += 1;
+                }
+            }
+        } else {
+            if (y0 > y1) {
+                std::swap(x0, x1);
+                std::swap(y0, y1);
+            }
+
+            // Per-pixel writes: walking the column bit mask measured slower
+            const int sx = (x0 < x1) ? 1 : -1;
+            int error = dy / 2;
+
+            for (int y = y0;; y += 1) {
+                setPixel(buffer, stride, x0, static_cast<Pixel>(y), on);
+                if (y == y1) { return; }
+
+                error -= dx;
+                if (error < 0) {
+                    error += dy;
+                    x0 = static_cast<Pixel>(x0 + sx);
+                }
+            }
+        }
+    }
+
+private:
+    /// @brief Set or clear masked bits of target byte
+    static inline void writeBits(BufferType &target, u8 mask, ColorType on) noexcept {
+        if (on) {
+            target |= mask;
+        } else {
+            target &= ~mask;
+        }
+    }
+
+    /// @brief Replace masked bits of target byte
+    static inline void writeMasked(BufferType &target, u8 mask, u8 bits) noexcept {
+        target = static_cast<u8>((target & ~mask) | (bits & mask));
+    }
+
+    /// @brief Read 8 pixels of a row starting at (possibly negative) pixel offset
+    /// @return MSB-first byte, pixels outside the row read as zero
+    static u8 fetchByte(const BufferType *row, usize row_bytes, int x) noexcept {
+        if (x < 0) { return static_cast<u8>(row[0] >> -x); }
+
+        const auto index = static_cast<usize>(x >> 3);
+        const auto shift = static_cast<u8>(x & 7);
+        const u8 next = (index + 1 < row_bytes) ? row[index + 1] : 0;
+        return static_cast<u8>(((row[index] << 8 | next) << shift) >> 8);
+    }
 };
 
 }// namespace kf
@@ -4,18 +4,35 @@
 #pragma once
 
 #include <kf/core/attributes.hpp>
+#include <kf/algorithm.hpp>
 #include <kf/core/pixel_traits.hpp>
+#include <kf/gfx/DynamicImage.hpp>
+#include <kf/math/units.hpp>
 #include <kf/memory/Slice.hpp>
 
 
 namespace kf {
 
+/// @brief Software frame buffer storage of DisplayDriver
+/// @tparam T Buffer element type
+/// @tparam N Buffer size in elements (0 - no frame buffer)
+template<typename T, usize N> struct DisplayFrameBuffer {
+protected:
+    /// @brief Software frame buffer for display operations
+    T software_screen_buffer[N]{};
+};
+
+/// @brief Empty storage for drivers rendering through band buffers
+template<typename T> struct DisplayFrameBuffer<T, 0> {};
+
 /// @brief CRTP base class for display driver implementations
 /// @tparam Impl Concrete driver implementation type
 /// @tparam F Physical display pixel format
 /// @tparam W Physical display width in pixels
 /// @tparam H Physical display height in pixels
-template<typename Impl, PixelFormat F, usize W, usize H> struct DisplayDriver {
+/// @tparam FrameBuffer Embed full software frame buffer (false - render through band buffers)
+template<typename Impl, PixelFormat F, usize W, usize H, bool FrameBuffer = true> struct DisplayDriver :
+    DisplayFrameBuffer<typename pixel_traits<F>::BufferType, FrameBuffer ? pixel_traits<F>::template buffer_size<W, H> : 0> {
     friend Impl;
 
 protected:
@@ -48,8 +65,8 @@ protected:
     /// @brief Required buffer size for the display
     static constexpr auto buffer_items{traits::template buffer_size<W, H>};
 
-    /// @brief Software frame buffer for display operations
-    BufferType software_screen_buffer[buffer_items]{};
+    /// @brief Driver embeds full software frame buffer
+    static constexpr bool has_frame_buffer{FrameBuffer};
 
 public:
     /// @brief Display orientation modes
@@ -66,25 +83,81 @@ public:
     kf_nodiscard bool init() noexcept { return impl().initImpl(); }
 
     /// @brief Get current display width in pixels (may differ from physical width due to orientation)
-    kf_nodiscard u8 width() const noexcept { return c_impl().getWidthImpl(); }
+    kf_nodiscard Pixel width() const noexcept { return c_impl().getWidthImpl(); }
 
     /// @brief Get current display height in pixels (may differ from physical width due to orientation)
-    kf_nodiscard u8 height() const noexcept { return c_impl().getHeightImpl(); }
+    kf_nodiscard Pixel height() const noexcept { return c_impl().getHeightImpl(); }
 
     /// @brief Transfer software buffer to display hardware
-    void send() const noexcept { c_impl().sendImpl(); }
+    void send() const noexcept {
+        static_assert(FrameBuffer, "Driver has no frame buffer, use renderStrips()");
+        c_impl().sendImpl();
+    }
+
+    /// @brief Transfer rectangular region of software buffer to display hardware
+    /// @param x Left position in current orientation
+    /// @param y Top position in current orientation
+    /// @param w Region width
+    /// @param h Region height
+    /// @note Region is clipped to display bounds, nothing is sent if it is empty
+    void sendRegion(Pixel x, Pixel y, Pixel w, Pixel h) const noexcept {
+        static_assert(FrameBuffer, "Driver has no frame buffer, use sendBand()");
+
+        const auto x0 = kf::max<Pixel>(x, 0);
+        const auto y0 = kf::max<Pixel>(y, 0);
+        const auto x1 = kf::min<Pixel>(static_cast<Pixel>(x + w), width());
+        const auto y1 = kf::min<Pixel>(static_cast<Pixel>(y + h), height());
+
+        if (x0 >= x1 or y0 >= y1) { return; }
+
+        c_impl().sendRegionImpl(x0, y0, static_cast<Pixel>(x1 - x0), static_cast<Pixel>(y1 - y0));
+    }
 
     /// @brief Set display orientation
     void setOrientation(Orientation orientation) noexcept { impl().setOrientationImpl(orientation); }
 
+    /// @brief Transfer full-width band of rows from external buffer to display hardware
+    /// @param y Top row of band in current orientation
+    /// @param rows Band height in rows
+    /// @param band Band pixels laid out with stride width()
+    /// @note Band is clipped to display height, nothing is sent if it is empty
+    void sendBand(Pixel y, Pixel rows, const BufferType *band) const noexcept {
+        if (y < 0 or rows < 1 or y >= height()) { return; }
+        c_impl().sendBandImpl(y, kf::min<Pixel>(rows, static_cast<Pixel>(height() - y)), band);
+    }
+
+    /// @brief Render and send whole frame strip by strip through band buffer
+    /// @param band Band buffer, strip height is the number of rows fitting into it
+    /// @param draw Callable (gfx::DynamicImage<F> strip, Pixel strip_y) drawing strip contents,
+    /// strip image covers display rows [strip_y, strip_y + strip.height)
+    /// @return false if band cannot hold a single strip
+    template<typename Draw> kf_nodiscard bool renderStrips(Slice<BufferType> band, Draw &&draw) const noexcept {
+        const Pixel w = width();
+        const Pixel h = height();
+
+        const usize aligned_items = traits::itemsFor(w, traits::row_alignment);
+        const auto strip_rows = static_cast<Pixel>((band.size() / aligned_items) * traits::row_alignment);
+        if (strip_rows < 1) { return false; }
+
+        for (Pixel y = 0; y < h; y = static_cast<Pixel>(y + strip_rows)) {
+            const auto rows = kf::min<Pixel>(strip_rows, static_cast<Pixel>(h - y));
+            draw(gfx::DynamicImage<F>{band.data(), w, w, rows, 0, 0}, y);
+            sendBand(y, rows, band.data());
+        }
+        return true;
+    }
+
     /// @brief Get writable software frame buffer
-    kf_nodiscard Slice<BufferType> buffer() noexcept { return {software_screen_buffer, buffer_items}; }
+    kf_nodiscard Slice<BufferType> buffer() noexcept {
+        static_assert(FrameBuffer, "Driver has no frame buffer");
+        return {this->software_screen_buffer, buffer_items};
+    }
 
     /// @brief Get maximum valid X coordinate for current orientation
-    kf_nodiscard u8 maxX() const noexcept { return width() - 1; }
+    kf_nodiscard Pixel maxX() const noexcept { return static_cast<Pixel>(width() - 1); }
 
     /// @brief Get maximum valid Y coordinate for current orientation
-    kf_nodiscard u8 maxY() const noexcept { return height() - 1; }
+    kf_nodiscard Pixel maxY() const noexcept { return static_cast<Pixel>(height() - 1); }
 
 private:
     inline Impl &impl() noexcept{ return *static_cast<Impl *>(this); }
@@ -0,0 +1,160 @@
+// Copyright (c) 2026 KiraFlux
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "kf/aliases.hpp"
+#include "kf/core/attributes.hpp"
+#include "kf/core/pixel_traits.hpp"
+#include "kf/drivers/display/DisplayDriver.hpp"
+#include "kf/math/units.hpp"
+
+
+namespace kf {
+
+/// @brief ILI9341 TFT display driver for 240x320 RGB565 panels (320x240 in landscape)
+/// @tparam Bus Command/data bus (SpiDisplayBus, parallel bus or host recording stand-in).
+/// Required interface: bool init(), void command(u8), void data(const u8 *, usize), void wait(Milliseconds)
+/// @note Has no frame buffer (150 KB): frames are rendered in strips through DisplayDriver::renderStrips
+template<typename Bus> struct ILI9341 : DisplayDriver<ILI9341<Bus>, PixelFormat::RGB565, 240, 320, false> {
+    using Base = DisplayDriver<ILI9341<Bus>, PixelFormat::RGB565, 240, 320, false>;
+    friend Base;
+
+    using typename Base::BufferType;
+    using typename Base::Orientation;
+
+private:
+    /// @brief Memory Access Control (MADCTL) register bits
+    enum MadCtl : u8 {
+        RgbMode = 0x00,///< RGB color order
+        BgrMode = 0x08,///< BGR color order
+
+        MirrorTranspose = 0x20,///< Swap X and Y axes (rotation)
+        MirrorX = 0x40,        ///< Horizontal mirror
+        MirrorY = 0x80,        ///< Vertical mirror
+    };
+
+public:
+    /// @brief Controller configuration settings
+    struct Config {
+        Orientation orientation;///< Initial display orientation
+        bool bgr_order;         ///< Panel uses BGR subpixel order
+
+        constexpr explicit Config(
+            Orientation orientation = Orientation::ClockWise,
+            bool bgr_order = true
+        ) noexcept:
+            orientation{orientation}, bgr_order{bgr_order} {}
+    };
+
+private:
+    const Config &settings;///< Controller configuration
+    Bus &bus;              ///< Command/data bus
+
+    Pixel logical_width{Base::phys_width};  ///< Current logical width (after orientation)
+    Pixel logical_height{Base::phys_height};///< Current logical height (after orientation)
+
+public:
+    explicit ILI9341(const Config &settings, Bus &bus) noexcept:
+        settings{settings}, bus{bus} {}
+
+private:
+    // DisplayDriver interface implementation
+
+    /// @brief Get current logical display width (after orientation transform)
+    kf_nodiscard Pixel getWidthImpl() const noexcept { return logical_width; }
+
+    /// @brief Get current logical display height (after orientation transform)
+    kf_nodiscard Pixel getHeightImpl() const noexcept { return logical_height; }
+
+    /// @brief Initialize controller through bus
+    kf_nodiscard bool initImpl() noexcept {
+        if (not bus.init()) { return false; }
+
+        sendCommand(Command::SWRESET);
+        bus.wait(150);
+
+        sendCommand(Command::SLPOUT);
+        bus.wait(120);
+
+        const u8 color_mode{0x55};// 16-bit color (RGB565) for RGB and MCU interfaces
+        sendCommand(Command::PIXSET);
+        bus.data(&color_mode, sizeof(color_mode));
+
+        this->setOrientation(settings.orientation);
+
+        sendCommand(Command::DISPON);
+        bus.wait(20);
+
+        return true;
+    }
+
+    /// @brief Transfer full-width band of rows
+    void sendBandImpl(Pixel y, Pixel rows, const BufferType *band) const noexcept {
+        setWindow(0, y, logical_width, rows);
+        sendCommand(Command::RAMWR);
+        bus.data(reinterpret_cast<const u8 *>(band), static_cast<usize>(logical_width) * rows * sizeof(BufferType));
+    }
+
+    /// @brief Apply orientation transformation (full 6-way support)
+    void setOrientationImpl(Orientation orientation) noexcept {
+        // Panel native scan is mirrored along X
+        constexpr u8 orient_to_transform[]{
+            MadCtl::MirrorX,                                             // Orientation::Normal
+            0,                                                           // Orientation::MirrorX
+            MadCtl::MirrorX | MadCtl::MirrorY,                           // Orientation::MirrorY
+            MadCtl::MirrorY,                                             // Orientation::Flip
+            MadCtl::MirrorTranspose,                                     // Orientation::ClockWise
+            MadCtl::MirrorX | MadCtl::MirrorY | MadCtl::MirrorTranspose, // Orientation::CounterClockWise
+        };
+
+        const u8 madctl = (settings.bgr_order ? MadCtl::BgrMode : MadCtl::RgbMode) | orient_to_transform[static_cast<u8>(orientation)];
+
+        if (madctl & MadCtl::MirrorTranspose) {
+            logical_width = Base::phys_height;
+            logical_height = Base::phys_width;
+        } else {
+            logical_width = Base::phys_width;
+            logical_height = Base::phys_height;
+        }
+
+        sendCommand(Command::MADCTL);
+        bus.data(&madctl, sizeof(madctl));
+    }
+
+    /// @brief ILI9341 command set (partial)
+    enum class Command : u8 {
+        SWRESET = 0x01,///< Software reset
+        SLPOUT = 0x11, ///< Exit sleep mode
+        DISPOFF = 0x28,///< Turn display off
+        DISPON = 0x29, ///< Turn display on
+        CASET = 0x2A,  ///< Set column address range
+        PASET = 0x2B,  ///< Set page (row) address range
+        RAMWR = 0x2C,  ///< Write to display RAM
+        MADCTL = 0x36, ///< Memory access control
+        PIXSET = 0x3A, ///< Pixel format setting
+    };
+
+    /// @brief Send single command to display
+    void sendCommand(Command command) const noexcept {
+        bus.command(static_cast<u8>(command));
+    }
+
+    /// @brief Set display RAM write window (logical coordinates)
+    void setWindow(Pixel x, Pixel y, Pixel w, Pixel h) const noexcept {
+        sendAddressRange(Command::CASET, x, static_cast<Pixel>(x + w - 1));
+        sendAddressRange(Command::PASET, y, static_cast<Pixel>(y + h - 1));
+    }
+
+    /// @brief Send CASET/PASET command with big-endian start and end address
+    void sendAddressRange(Command command, Pixel start, Pixel end) const noexcept {
+        const u8 data[4] = {
+            static_cast<u8>(start >> 8), static_cast<u8>(start),
+            static_cast<u8>(end >> 8), static_cast<u8>(end),
+        };
+        sendCommand(command);
+        bus.data(data, sizeof(data));
+    }
+};
+
+}// namespace kf
\ No newline at end of file
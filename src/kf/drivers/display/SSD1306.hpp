@@ -142,6 +142,45 @@ private:
         }
     }
 
+    /// @brief Transfer clipped region via I2C using column/page window
+    /// @note Region is extended to whole 8-pixel pages vertically
+    void sendRegionImpl(Pixel x, Pixel y, Pixel w, Pixel h) const noexcept {
+        static constexpr auto packet_size = 64;
+
+        const auto first_page = static_cast<u8>(y / traits::page_height);
+        const auto last_page = static_cast<u8>((y + h - 1) / traits::page_height);
+
+        const u8 set_area_commands[] = {
+            CommandMode,
+            ColumnAddr,
+            static_cast<u8>(x),
+            static_cast<u8>(x + w - 1),
+            PageAddr,
+            first_page,
+            last_page,
+        };
+
+        wire.beginTransmission(config.address);
+        (void) wire.write(set_area_commands, sizeof(set_area_commands));
+        (void) wire.endTransmission();
+
+        for (auto page = first_page; page <= last_page; page += 1) {
+            auto p = software_screen_buffer + page * phys_width + x;
+            const auto *end = p + w;
+
+            while (p < end) {
+                const auto chunk = static_cast<usize>(kf::min<isize>(packet_size, end - p));
+
+                wire.beginTransmission(config.address);
+                (void) wire.write(Command::DataMode);
+                (void) wire.write(p, chunk);
+                (void) wire.endTransmission();
+
+                p += chunk;
+            }
+        }
+    }
+
     /// @brief Apply orientation transformation (only flip operations supported)
     void setOrientationImpl(Orientation orientation) noexcept {
         constexpr auto flip_x = 0b01;
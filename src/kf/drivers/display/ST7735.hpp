@@ -106,11 +106,29 @@ private:
     }
 
     void sendImpl() const noexcept {
+        setWindow(0, 0, logical_width, logical_height);
         sendCommand(Command::RAMWR);
         sendData(reinterpret_cast<const u8 *>(software_screen_buffer),
                  sizeof(software_screen_buffer));
     }
 
+    /// @brief Transfer clipped region using CASET/RASET window and row gathers
+    void sendRegionImpl(Pixel x, Pixel y, Pixel w, Pixel h) const noexcept {
+        setWindow(x, y, w, h);
+        sendCommand(Command::RAMWR);
+
+        digitalWrite(settings.pin_data_command, HIGH);
+        digitalWrite(settings.pin_spi_slave_select, LOW);
+
+        const BufferType *row = software_screen_buffer + y * logical_width + x;
+        for (Pixel r = 0; r < h; r += 1) {
+            spi.writeBytes(reinterpret_cast<const u8 *>(row), w * sizeof(BufferType));
+            row += logical_width;
+        }
+
+        digitalWrite(settings.pin_spi_slave_select, HIGH);
+    }
+
     /// @brief Apply orientation transformation (full 6-way support)
     void setOrientationImpl(Orientation orientation) noexcept {
         constexpr u8 orient_to_transform[]{
@@ -135,13 +153,7 @@ private:
         sendCommand(Command::MADCTL);
         sendData(&madctl, sizeof(madctl));
 
-        u8 data[4] = {0x00, 0x00, 0x00, static_cast<u8>(logical_width - 1)};
-        sendCommand(Command::CASET);
-        sendData(data, sizeof(data));
-
-        data[3] = logical_height - 1;
-        sendCommand(Command::RASET);
-        sendData(data, sizeof(data));
+        setWindow(0, 0, logical_width, logical_height);
     }
 
     // Low-level SPI communication
@@ -180,6 +192,22 @@ private:
         spi.write(static_cast<u8>(command));
         digitalWrite(settings.pin_spi_slave_select, HIGH);
     }
+
+    /// @brief Set display RAM write window (logical coordinates)
+    void setWindow(Pixel x, Pixel y, Pixel w, Pixel h) const noexcept {
+        sendAddressRange(Command::CASET, x, static_cast<Pixel>(x + w - 1));
+        sendAddressRange(Command::RASET, y, static_cast<Pixel>(y + h - 1));
+    }
+
+    /// @brief Send CASET/RASET command with big-endian start and end address
+    void sendAddressRange(Command command, Pixel start, Pixel end) const noexcept {
+        const u8 data[4] = {
+            static_cast<u8>(start >> 8), static_cast<u8>(start),
+            static_cast<u8>(end >> 8), static_cast<u8>(end),
+        };
+        sendCommand(command);
+        sendData(data, sizeof(data));
+    }
 };
 
 }// namespace kf
@@ -0,0 +1,85 @@
+// Copyright (c) 2026 KiraFlux
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <Arduino.h>
+#include <SPI.h>
+
+#include "kf/aliases.hpp"
+#include "kf/core/attributes.hpp"
+#include "kf/math/units.hpp"
+
+
+namespace kf {
+
+/// @brief 4-wire SPI command/data bus for display controllers
+/// @note Implements Bus interface used by bus-generic display drivers (ILI9341)
+struct SpiDisplayBus {
+
+    /// @brief Bus hardware configuration
+    struct Config {
+        u32 spi_frequency;      ///< SPI clock frequency in Hz
+        u8 pin_spi_slave_select;///< SPI chip select pin
+        u8 pin_data_command;    ///< Data/command selection pin
+        u8 pin_reset;           ///< Reset pin
+
+        constexpr explicit Config(
+            gpio_num_t spi_cs,
+            gpio_num_t dc,
+            gpio_num_t reset,
+            u32 spi_freq = 40000000u
+        ) noexcept:
+            spi_frequency{spi_freq},
+            pin_spi_slave_select{static_cast<u8>(spi_cs)},
+            pin_data_command{static_cast<u8>(dc)},
+            pin_reset{static_cast<u8>(reset)} {}
+    };
+
+private:
+    const Config &settings;///< Hardware configuration
+    SPIClass &spi;         ///< SPI bus instance
+
+public:
+    explicit SpiDisplayBus(const Config &settings, SPIClass &spi_instance) noexcept:
+        settings{settings}, spi{spi_instance} {}
+
+    /// @brief Configure pins, SPI and perform hardware reset
+    kf_nodiscard bool init() noexcept {
+        pinMode(settings.pin_spi_slave_select, OUTPUT);
+        pinMode(settings.pin_data_command, OUTPUT);
+        pinMode(settings.pin_reset, OUTPUT);
+        digitalWrite(settings.pin_spi_slave_select, HIGH);
+
+        spi.begin();
+        spi.setFrequency(settings.spi_frequency);
+
+        digitalWrite(settings.pin_reset, LOW);
+        delay(10);
+        digitalWrite(settings.pin_reset, HIGH);
+        delay(120);
+
+        return true;
+    }
+
+    /// @brief Send single command byte
+    void command(u8 code) noexcept {
+        digitalWrite(settings.pin_data_command, LOW);
+        digitalWrite(settings.pin_spi_slave_select, LOW);
+        spi.write(code);
+        digitalWrite(settings.pin_spi_slave_select, HIGH);
+    }
+
+    /// @brief Send data bytes
+    void data(const u8 *bytes, usize size) noexcept {
+        digitalWrite(settings.pin_data_command, HIGH);
+        digitalWrite(settings.pin_spi_slave_select, LOW);
+        spi.writeBytes(bytes, size);
+        digitalWrite(settings.pin_spi_slave_select, HIGH);
+    }
+
+    /// @brief Blocking delay required by controller timings
+    static void wait(Milliseconds duration) noexcept { delay(duration); }
+};
+
+}// namespace kf
\ No newline at end of file
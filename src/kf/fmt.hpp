@@ -0,0 +1,350 @@
+// Copyright (c) 2026 KiraFlux
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <type_traits>
+
+#include "kf/algorithm.hpp"
+#include "kf/aliases.hpp"
+#include "kf/core/attributes.hpp"
+#include "kf/core/number_format.hpp"
+#include "kf/memory/Array.hpp"
+#include "kf/memory/Slice.hpp"
+#include "kf/memory/StringView.hpp"
+
+/// @brief Make compile-time format pattern from string literal
+/// @param literal printf-style format string literal (see kf::fmt::write for syntax)
+#define kf_fmt(literal) ([] {                                                \
+    struct kf_fmt_pattern : kf::fmt::Pattern {                               \
+        static constexpr const char *text() noexcept { return literal; }     \
+    };                                                                       \
+    return kf_fmt_pattern{};                                                 \
+}())
+
+
+namespace kf::fmt {
+
+/// @brief Base of compile-time patterns (made by kf_fmt macro)
+struct Pattern {};
+
+/// @brief Pattern piece kind
+enum class Kind : u8 {
+    Literal, ///< Pattern text
+    Signed,  ///< %d, %i
+    Unsigned,///< %u
+    Hex,     ///< %x, %X
+    Char,    ///< %c
+    String,  ///< %s
+    Real,    ///< %f
+};
+
+/// @brief Pattern parse error
+enum class Error : u8 {
+    None,               ///< Pattern is valid
+    DanglingPercent,    ///< Pattern ends inside conversion
+    UnknownConversion,  ///< Unsupported conversion character
+    WidthTooLarge,      ///< Width above max_width
+    PrecisionTooLarge,  ///< Precision above max_precision
+    PrecisionNotAllowed,///< Precision given for conversion other than %f
+};
+
+/// @brief Maximal conversion width
+constexpr u8 max_width{99};
+
+/// @brief Maximal %f precision
+constexpr u8 max_precision{20};
+
+/// @brief Default %f precision
+constexpr u8 default_precision{6};
+
+/// @brief Parsed pattern piece (literal text or argument conversion)
+struct Piece {
+    Kind kind{Kind::Literal};     ///< Piece kind
+    usize offset{0};              ///< Literal text offset in pattern
+    usize length{0};              ///< Literal text length
+    u8 width{0};                  ///< Minimal conversion width
+    u8 precision{default_precision};///< %f fraction digits
+    bool zero{false};             ///< Pad with '0' instead of ' '
+    bool upper{false};            ///< Upper case hexadecimal digits
+};
+
+/// @brief Pattern parse summary
+struct Summary {
+    usize pieces{0};     ///< Literal and conversion pieces
+    usize arguments{0};  ///< Conversion pieces
+    Error error{Error::None};///< First error found
+};
+
+/// @brief Parse pattern into pieces
+/// @param text printf-style pattern: %[0][width][.precision]conversion, conversions d i u x X c s f and %%
+/// @param pieces Output pieces (nullptr to count only)
+/// @return Parse summary
+constexpr Summary parse(const char *text, Piece *pieces) noexcept {
+    Summary summary{};
+    usize literal_start = 0;
+
+    const auto emit = [&](const Piece &piece) {
+        if (pieces != nullptr) { pieces[summary.pieces] = piece; }
+        summary.pieces += 1;
+    };
+
+    const auto flushLiteral = [&](usize end) {
+        if (end == literal_start) { return; }
+        Piece piece{};
+        piece.offset = literal_start;
+        piece.length = end - literal_start;
+        emit(piece);
+    };
+
+    const auto isDigit = [](char c) { return c >= '0' and c <= '9'; };
+
+    usize i = 0;
+    while (text[i] != '\0') {
+        if (text[i] != '%') {
+            i += 1;
+            continue;
+        }
+
+        if (text[i + 1] == '%') {
+            // Keep first '%' as literal text, skip second
+            flushLiteral(i + 1);
+            i += 2;
+            literal_start = i;
+            continue;
+        }
+
+        flushLiteral(i);
+        i += 1;
+
+        Piece piece{};
+        bool has_precision = false;
+
+        if (text[i] == '0') {
+            piece.zero = true;
+            i += 1;
+        }
+
+        for (usize width = 0; isDigit(text[i]); i += 1) {
+            width = width * 10 + static_cast<usize>(text[i] - '0');
+            if (width > max_width) {
+                summary.error = Error::WidthTooLarge;
+                return summary;
+            }
+            piece.width = static_cast<u8>(width);
+        }
+
+        if (text[i] == '.') {
+            i += 1;
+            has_precision = true;
+            usize precision = 0;
+            for (; isDigit(text[i]); i += 1) {
+                precision = precision * 10 + static_cast<usize>(text[i] - '0');
+                if (precision > max_precision) {
+                    summary.error = Error::PrecisionTooLarge;
+                    return summary;
+                }
+            }
+            piece.precision = static_cast<u8>(precision);
+        }
+
+        switch (text[i]) {
+            case 'd':
+            case 'i': piece.kind = Kind::Signed;
+                break;
+            case 'u': piece.kind = Kind::Unsigned;
+                break;
+            case 'X': piece.upper = true;
+                piece.kind = Kind::Hex;
+                break;
+            case 'x': piece.kind = Kind::Hex;
+                break;
+            case 'c': piece.kind = Kind::Char;
+                break;
+            case 's': piece.kind = Kind::String;
+                break;
+            case 'f': piece.kind = Kind::Real;
+                break;
+            case '\0': summary.error = Error::DanglingPercent;
+                return summary;
+            default: summary.error = Error::UnknownConversion;
+                return summary;
+        }
+
+        if (has_precision and piece.kind != Kind::Real) {
+            summary.error = Error::PrecisionNotAllowed;
+            return summary;
+        }
+
+        emit(piece);
+        summary.arguments += 1;
+        i += 1;
+        literal_start = i;
+    }
+
+    flushLiteral(i);
+    return summary;
+}
+
+/// @brief Pattern parsed at compile time
+/// @tparam P Pattern type (made by kf_fmt macro)
+template<typename P> struct Compiled {
+    static_assert(std::is_base_of<Pattern, P>::value, "kf::fmt: pattern must be made with kf_fmt(\"...\")");
+
+    /// @brief Parse summary
+    static constexpr Summary summary{parse(P::text(), nullptr)};
+
+    static_assert(summary.error != Error::DanglingPercent, "kf::fmt: pattern ends inside conversion");
+    static_assert(summary.error != Error::UnknownConversion, "kf::fmt: unsupported conversion (use d i u x X c s f %)");
+    static_assert(summary.error != Error::WidthTooLarge, "kf::fmt: width above kf::fmt::max_width");
+    static_assert(summary.error != Error::PrecisionTooLarge, "kf::fmt: precision above kf::fmt::max_precision");
+    static_assert(summary.error != Error::PrecisionNotAllowed, "kf::fmt: precision is supported only for %f");
+
+private:
+    static constexpr Array<Piece, summary.pieces> build() noexcept {
+        Array<Piece, summary.pieces> result{};
+        (void) parse(P::text(), result.data());
+        return result;
+    }
+
+public:
+    /// @brief Parsed pieces
+    static constexpr Array<Piece, summary.pieces> pieces{build()};
+};
+
+/// @brief Check if argument type matches conversion
+template<typename T> constexpr bool accepts(Kind kind) noexcept {
+    using U = std::remove_cv_t<T>;
+    constexpr bool integer = std::is_integral<U>::value and not std::is_same<U, bool>::value and
+                             not std::is_same<U, char>::value and sizeof(U) <= sizeof(u32);
+
+    switch (kind) {
+        case Kind::Signed: return integer and (std::is_signed<U>::value or sizeof(U) < sizeof(i32));
+        case Kind::Unsigned: return integer and std::is_unsigned<U>::value;
+        case Kind::Hex: return integer;
+        case Kind::Char: return std::is_same<U, char>::value;
+        case Kind::String: return std::is_convertible<const U &, StringView>::value;
+        case Kind::Real: return std::is_floating_point<U>::value;
+        case Kind::Literal: return false;
+    }
+    return false;
+}
+
+/// @brief Bounded output cursor (truncates silently)
+struct Writer {
+    char *out;  ///< Output buffer
+    usize capacity;///< Output buffer size
+    usize size{0};///< Characters written
+
+    /// @brief Write text
+    void text(const char *data, usize length) noexcept {
+        const auto count = kf::min(length, capacity - size);
+        for (usize i = 0; i < count; i += 1) { out[size + i] = data[i]; }
+        size += count;
+    }
+
+    /// @brief Write character count times
+    void fill(char c, usize count) noexcept {
+        count = kf::min(count, capacity - size);
+        for (usize i = 0; i < count; i += 1) { out[size + i] = c; }
+        size += count;
+    }
+
+    /// @brief Write text right-aligned to width ('0' padding goes after sign)
+    void padded(const char *data, usize length, u8 width, bool zero) noexcept {
+        const usize padding = (width > length) ? width - length : 0;
+
+        if (zero and length > 0 and data[0] == '-') {
+            text(data, 1);
+            fill('0', padding);
+            text(data + 1, length - 1);
+            return;
+        }
+
+        fill(zero ? '0' : ' ', padding);
+        text(data, length);
+    }
+};
+
+/// @brief Write conversion piece I of pattern P
+template<typename P, usize I, typename T> void writeArgument(Writer &writer, const T &value) noexcept {
+    constexpr const Piece &piece = Compiled<P>::pieces[I];
+
+    static_assert(piece.kind != Kind::Signed or accepts<T>(Kind::Signed), "kf::fmt: %d expects signed integer up to 32 bits");
+    static_assert(piece.kind != Kind::Unsigned or accepts<T>(Kind::Unsigned), "kf::fmt: %u expects unsigned integer up to 32 bits");
+    static_assert(piece.kind != Kind::Hex or accepts<T>(Kind::Hex), "kf::fmt: %x expects integer up to 32 bits");
+    static_assert(piece.kind != Kind::Char or accepts<T>(Kind::Char), "kf::fmt: %c expects char");
+    static_assert(piece.kind != Kind::String or accepts<T>(Kind::String), "kf::fmt: %s expects string (convertible to StringView)");
+    static_assert(piece.kind != Kind::Real or accepts<T>(Kind::Real), "kf::fmt: %f expects floating point value");
+
+    if constexpr (piece.kind == Kind::Signed) {
+        char digits[max_integer_chars]{};
+        writer.padded(digits, formatSigned(digits, static_cast<i32>(value)), piece.width, piece.zero);
+    } else if constexpr (piece.kind == Kind::Unsigned) {
+        char digits[max_integer_chars]{};
+        writer.padded(digits, formatUnsigned(digits, static_cast<u32>(value)), piece.width, piece.zero);
+    } else if constexpr (piece.kind == Kind::Hex) {
+        char digits[max_hex_chars]{};
+        writer.padded(digits, formatHex(digits, static_cast<u32>(value), piece.upper), piece.width, piece.zero);
+    } else if constexpr (piece.kind == Kind::Char) {
+        writer.padded(&value, 1, piece.width, piece.zero);
+    } else if constexpr (piece.kind == Kind::String) {
+        const StringView view{value};
+        writer.padded(view.data(), view.size(), piece.width, piece.zero);
+    } else if constexpr (piece.kind == Kind::Real) {
+        char digits[max_integer_chars + 2 + piece.precision];
+        writer.padded(digits, formatFixed(digits, static_cast<f64>(value), piece.precision), piece.width, piece.zero);
+    }
+}
+
+template<typename P, usize I> void writePieces(Writer &writer) noexcept;
+
+template<typename P, usize I, typename First, typename... Rest> void writePieces(Writer &writer, const First &first, const Rest &...rest) noexcept;
+
+/// @brief Write pieces from I (no arguments left)
+template<typename P, usize I> void writePieces(Writer &writer) noexcept {
+    if constexpr (I < Compiled<P>::pieces.size()) {
+        constexpr const Piece &piece = Compiled<P>::pieces[I];
+        writer.text(P::text() + piece.offset, piece.length);
+        writePieces<P, I + 1>(writer);
+    }
+}
+
+/// @brief Write pieces from I, consuming first argument at next conversion
+template<typename P, usize I, typename First, typename... Rest> void writePieces(Writer &writer, const First &first, const Rest &...rest) noexcept {
+    constexpr const Piece &piece = Compiled<P>::pieces[I];
+
+    if constexpr (piece.kind == Kind::Literal) {
+        writer.text(P::text() + piece.offset, piece.length);
+        writePieces<P, I + 1>(writer, first, rest...);
+    } else {
+        writeArgument<P, I>(writer, first);
+        writePieces<P, I + 1>(writer, rest...);
+    }
+}
+
+/// @brief Format arguments into buffer
+/// @details Pattern is parsed at compile time, argument types are checked against conversions
+/// at compile time, call expands into direct number and text writes (no vsnprintf).
+/// Syntax: %[0][width][.precision]conversion
+/// - %d %i - signed integer (up to 32 bits)
+/// - %u - unsigned integer (up to 32 bits)
+/// - %x %X - hexadecimal integer (up to 32 bits)
+/// - %c - char
+/// - %s - string (const char *, StringView)
+/// - %f - floating point, precision (default 6) fraction digits truncated as ArrayString::append(f64)
+/// - %% - percent sign
+/// @param out Output buffer (not null-terminated)
+/// @param pattern Pattern made by kf_fmt("...")
+/// @param args Arguments matching conversions
+/// @return Characters written (output truncated to buffer size)
+template<typename P, typename... Args> usize write(Slice<char> out, P pattern, const Args &...args) noexcept {
+    (void) pattern;
+    static_assert(Compiled<P>::summary.arguments == sizeof...(Args), "kf::fmt: argument count does not match pattern");
+
+    Writer writer{out.data(), out.size()};
+    writePieces<P, 0>(writer, args...);
+    return writer.size;
+}
+
+}// namespace kf::fmt
\ No newline at end of file
@@ -9,6 +9,8 @@
 namespace kf::gfx {}
 
 #include "kf/gfx/Canvas.hpp"
+#include "kf/gfx/ColorTable.hpp"
 #include "kf/gfx/DynamicImage.hpp"
 #include "kf/gfx/Font.hpp"
+#include "kf/gfx/Plot.hpp"
 #include "kf/gfx/StaticImage.hpp"
@@ -9,8 +9,10 @@
 #include "kf/core/attributes.hpp"
 #include "kf/core/pixel_traits.hpp"
 #include "kf/memory/Array.hpp"
+#include "kf/memory/StringView.hpp"
 
 #include "kf/gfx/ColorPalette.hpp"
+#include "kf/gfx/ColorTable.hpp"
 #include "kf/gfx/DynamicImage.hpp"
 #include "kf/gfx/Font.hpp"
 #include "kf/gfx/StaticImage.hpp"
@@ -34,6 +36,9 @@ private:
     static constexpr ColorType default_foreground_color{Palette::getAnsiColor(Palette::Ansi::WhiteBright)};
     static constexpr ColorType default_background_color{Palette::getAnsiColor(Palette::Ansi::Black)};
 
+    /// @brief Lines shorter than this on both axes are plotted per pixel (kernel setup does not pay off)
+    static constexpr Pixel short_line_pixels{16};
+
     DynamicImage<F> frame;     ///< Target drawing surface
     const Font *current_font;  ///< Currently selected font
     ColorType foreground_color;///< Drawing color
@@ -232,26 +237,31 @@ public:
 
         const auto dx = static_cast<Pixel>(std::abs(x1 - x0));
         const auto dy = static_cast<Pixel>(-std::abs(y1 - y0));
-        const auto sx = (x0 < x1) ? 1 : -1;
-        const auto sy = (y0 < y1) ? 1 : -1;
-        auto error = dx + dy;
-
-        while (true) {
-            frame.setPixel(x0, y0, foreground_color);
-            if (x0 == x1 and y0 == y1) { break; }
-
-            const auto double_error = 2 * error;
-            if (double_error >= dy) {
-                if (x0 == x1) { break; }
-                error += dy;
-                x0 = static_cast<Pixel>(x0 + sx);
-            }
-            if (double_error <= dx) {
-                if (y0 == y1) { break; }
-                error += dx;
-                y0 = static_cast<Pixel>(y0 + sy);
+
+        if (dx < short_line_pixels and -dy < short_line_pixels) {
+            const auto sx = (x0 < x1) ? 1 : -1;
+            const auto sy = (y0 < y1) ? 1 : -1;
+            auto error = dx + dy;
+
+            while (true) {
+                frame.setPixel(x0, y0, foreground_color);
+                if (x0 == x1 and y0 == y1) { return; }
+
+                const auto double_error = 2 * error;
+                if (double_error >= dy) {
+                    if (x0 == x1) { return; }
+                    error += dy;
+                    x0 = static_cast<Pixel>(x0 + sx);
+                }
+                if (double_error <= dx) {
+                    if (y0 == y1) { return; }
+                    error += dx;
+                    y0 = static_cast<Pixel>(y0 + sy);
+                }
             }
         }
+
+        frame.line(x0, y0, x1, y1, foreground_color);
     }
 
     /// @brief Draw rectangle (filled or outline)
@@ -271,6 +281,42 @@ public:
         }
     }
 
+    /// @brief Fill rectangle with precomputed color gradient
+    /// @details Table entries are spread across the rectangle and each run of
+    /// equal entries is written with a single fill
+    /// @param table Precomputed colors (first entry at left/top)
+    /// @param horizontal True if color changes along X, false if along Y
+    template<usize N> void gradient(
+        Pixel x0, Pixel y0, Pixel x1, Pixel y1,
+        const ColorTable<F, N> &table,
+        bool horizontal = true
+    ) const noexcept {
+        if (x0 > x1) { std::swap(x0, x1); }
+        if (y0 > y1) { std::swap(y0, y1); }
+
+        const Pixel from = horizontal ? x0 : y0;
+        const Pixel to = horizontal ? x1 : y1;
+        const auto span = static_cast<usize>(kf::max(to - from, 1));
+
+        Pixel run_start = from;
+        usize run_index = 0;
+
+        for (auto p = static_cast<Pixel>(from + 1); p <= to + 1; p += 1) {
+            const usize index = (p <= to) ? static_cast<usize>(p - from) * (N - 1) / span : N;
+            if (index == run_index) { continue; }
+
+            const auto run_end = static_cast<Pixel>(p - 1);
+            if (horizontal) {
+                frame.fill(run_start, y0, run_end, y1, table[run_index]);
+            } else {
+                frame.fill(x0, run_start, x1, run_end, table[run_index]);
+            }
+
+            run_start = p;
+            run_index = index;
+        }
+    }
+
     /// @brief Draw circle (filled or outline)
     void circle(Pixel cx, Pixel cy, Pixel r, bool fill) noexcept {
         if (r < 0) { return; }
@@ -323,7 +369,15 @@ public:
     ///   \x84 - Set custom background color (ANSI color index)
     ///   \n - New line
     ///   \t - Tab (4 character widths)
-    void text(Pixel start_x, Pixel start_y, const char *text) noexcept {
+    /// @return X position following last drawn glyph
+    Pixel text(Pixel start_x, Pixel start_y, const char *text) noexcept {
+        return this->text(start_x, start_y, StringView{text});
+    }
+
+    /// @brief Draw text view at specified position
+    /// @details Same formatting codes as text(const char *), text does not have to be null-terminated
+    /// @return X position following last drawn glyph
+    Pixel text(Pixel start_x, Pixel start_y, StringView text) noexcept {
         Pixel cursor_x = start_x;
         Pixel cursor_y = start_y;
         const u8 font_width = current_font->glyph_width;
@@ -332,8 +386,8 @@ public:
         ColorType current_foreground_color = foreground_color;
         ColorType current_background_color = background_color;
 
-        for (; *text != '\0'; ++text) {
-            switch (*text) {
+        for (const char ch: text) {
+            switch (ch) {
                 case '\x80': {
                     current_foreground_color = foreground_color;
                     current_background_color = background_color;
@@ -365,7 +419,7 @@ public:
                 case '\xFD':
                 case '\xFE':
                 case '\xFF': {
-                    current_foreground_color = Palette::getAnsiColor(static_cast<typename Palette::Ansi>(*text));
+                    current_foreground_color = Palette::getAnsiColor(static_cast<typename Palette::Ansi>(ch));
                     continue;
                 }
 
@@ -385,7 +439,7 @@ public:
                 case '\xBD':
                 case '\xBE':
                 case '\xBF': {
-                    current_background_color = Palette::getAnsiColor(static_cast<typename Palette::Ansi>(*text));
+                    current_background_color = Palette::getAnsiColor(static_cast<typename Palette::Ansi>(ch));
                     continue;
                 }
 
@@ -411,13 +465,13 @@ public:
                     cursor_x = start_x;
                     cursor_y = static_cast<Pixel>(cursor_y + font_total_height);
                 } else {
-                    return;
+                    return cursor_x;
                 }
             }
 
-            if (cursor_y > static_cast<Pixel>(height() - font_height)) { return; }
+            if (cursor_y > static_cast<Pixel>(height() - font_height)) { return cursor_x; }
 
-            drawGlyph(cursor_x, cursor_y, current_font->getGlyph(*text), current_foreground_color, current_background_color);
+            drawGlyph(cursor_x, cursor_y, current_font->getGlyph(ch), current_foreground_color, current_background_color);
 
             cursor_x = static_cast<Pixel>(cursor_x + font_width);
             if (cursor_x < width()) {
@@ -429,6 +483,7 @@ public:
             }
             cursor_x = static_cast<Pixel>(cursor_x + 1);
         }
+        return cursor_x;
     }
 
 private:
@@ -489,20 +544,7 @@ private:
             return;
         }
 
-        const u8 font_width = current_font->glyph_width;
-        const u8 font_height = current_font->glyph_height;
-
-        for (u8 col = 0; col < font_width; ++col) {
-            const auto pixel_x = static_cast<Pixel>(x + col);
-            const u8 glyph_byte = glyph[col];
-
-            for (u8 row = 0; row < font_height; row += 1) {
-                const auto color = (glyph_byte >> row) & 1 ? color_on : color_off;
-                frame.setPixel(pixel_x, static_cast<Pixel>(y + row), color);
-            }
-
-            frame.setPixel(pixel_x, static_cast<Pixel>(y + font_height), color_off);
-        }
+        frame.glyph(x, y, glyph, current_font->glyph_width, current_font->glyph_height, color_on, color_off);
     }
 };
 
@@ -0,0 +1,135 @@
+// Copyright (c) 2026 KiraFlux
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "kf/algorithm.hpp"
+#include "kf/aliases.hpp"
+#include "kf/core/PixelFormat.hpp"
+#include "kf/core/attributes.hpp"
+#include "kf/core/pixel_traits.hpp"
+#include "kf/memory/Array.hpp"
+
+
+namespace kf::gfx {
+
+/// @brief 24-bit RGB color for compile-time color computations
+struct Rgb {
+    u8 r;///< Red channel
+    u8 g;///< Green channel
+    u8 b;///< Blue channel
+
+    /// @brief Convert to native color of pixel format
+    template<PixelFormat F> kf_nodiscard constexpr typename pixel_traits<F>::ColorType to() const noexcept {
+        return pixel_traits<F>::fromRgb(r, g, b);
+    }
+
+    /// @brief Linear interpolation between two colors
+    /// @param from Color at position 0
+    /// @param to Color at position den
+    /// @param num Position numerator
+    /// @param den Position denominator (must be positive)
+    kf_nodiscard static constexpr Rgb lerp(Rgb from, Rgb to, u32 num, u32 den) noexcept {
+        return Rgb{
+            lerpChannel(from.r, to.r, num, den),
+            lerpChannel(from.g, to.g, num, den),
+            lerpChannel(from.b, to.b, num, den),
+        };
+    }
+
+private:
+    static constexpr u8 lerpChannel(u8 from, u8 to, u32 num, u32 den) noexcept {
+        return static_cast<u8>(from + (static_cast<i32>(to) - static_cast<i32>(from)) * static_cast<i32>(num) / static_cast<i32>(den));
+    }
+};
+
+/// @brief Precomputed table of native colors
+/// @tparam F Pixel format of stored colors
+/// @tparam N Number of table entries
+/// @details Intended to be built at compile time (palettes, gradients, heatmaps),
+/// so per-frame color computation becomes a table lookup
+template<PixelFormat F, usize N> struct ColorTable {
+    static_assert(N > 0, "ColorTable must not be empty");
+
+    using ColorType = typename pixel_traits<F>::ColorType;///< Native color type
+
+    Array<ColorType, N> colors;///< Table entries
+
+    /// @brief Build table from RGB palette
+    kf_nodiscard static constexpr ColorTable palette(const Rgb (&rgb)[N]) noexcept {
+        ColorTable ret{};
+        for (usize i = 0; i < N; i += 1) {
+            ret.colors[i] = rgb[i].template to<F>();
+        }
+        return ret;
+    }
+
+    /// @brief Build two-color linear gradient
+    kf_nodiscard static constexpr ColorTable gradient(Rgb from, Rgb to) noexcept {
+        const Rgb stops[2]{from, to};
+        return gradient(stops);
+    }
+
+    /// @brief Build multi-stop linear gradient with evenly spaced stops
+    /// @tparam S Number of gradient stops (>= 2)
+    template<usize S> kf_nodiscard static constexpr ColorTable gradient(const Rgb (&stops)[S]) noexcept {
+        static_assert(S >= 2, "Gradient requires at least 2 stops");
+
+        ColorTable ret{};
+        if (N == 1) {
+            ret.colors[0] = stops[0].template to<F>();
+            return ret;
+        }
+
+        const u32 den = static_cast<u32>(N - 1);
+        for (usize i = 0; i < N; i += 1) {
+            // Position along the whole gradient in units of 1 / (N - 1) per stop interval
+            const u32 scaled = static_cast<u32>(i) * static_cast<u32>(S - 1);
+            const usize segment = kf::min(static_cast<usize>(scaled / den), S - 2);
+            const u32 num = scaled - static_cast<u32>(segment) * den;
+            ret.colors[i] = Rgb::lerp(stops[segment], stops[segment + 1], num, den).template to<F>();
+        }
+        return ret;
+    }
+
+    /// @brief Get table size
+    kf_nodiscard static constexpr usize size() noexcept { return N; }
+
+    /// @brief Get color by index (no bounds checking)
+    kf_nodiscard constexpr ColorType operator[](usize index) const noexcept { return colors[index]; }
+
+    /// @brief Map value within range to table entry
+    /// @param value Value to map (clamped to [low, high])
+    /// @param low Value mapped to first entry
+    /// @param high Value mapped to last entry
+    template<typename T> kf_nodiscard constexpr ColorType map(T value, T low, T high) const noexcept {
+        if (not(low < high) or not(low < value)) { return colors[0]; }
+        if (not(value < high)) { return colors[N - 1]; }
+        return colors[static_cast<usize>((value - low) * static_cast<T>(N - 1) / (high - low))];
+    }
+};
+
+/// @brief Common gradient stops
+namespace gradients {
+
+/// @brief Blue - cyan - green - yellow - red heatmap stops
+constexpr Rgb heatmap[]{
+    {0x00, 0x00, 0xFF},
+    {0x00, 0xFF, 0xFF},
+    {0x00, 0xFF, 0x00},
+    {0xFF, 0xFF, 0x00},
+    {0xFF, 0x00, 0x00},
+};
+
+/// @brief Black - white grayscale stops
+constexpr Rgb grayscale[]{
+    {0x00, 0x00, 0x00},
+    {0xFF, 0xFF, 0xFF},
+};
+
+}// namespace gradients
+
+/// @brief 256-entry heatmap lookup table computed at compile time
+template<PixelFormat F> constexpr ColorTable<F, 256> heatmap_table{ColorTable<F, 256>::gradient(gradients::heatmap)};
+
+}// namespace kf::gfx
\ No newline at end of file
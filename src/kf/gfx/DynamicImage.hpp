@@ -171,6 +171,26 @@ public:
         );
     }
 
+    /// @brief Draws diagonal line between two points (both inclusive)
+    /// @note Uses format-specific Bresenham kernel without per-pixel addressing
+    inline void line(Pixel x0, Pixel y0, Pixel x1, Pixel y1, ColorType color) const noexcept {
+        Traits::line(buffer, stride, toAbsoluteX(x0), toAbsoluteY(y0), toAbsoluteX(x1), toAbsoluteY(y1), color);
+    }
+
+    /// @brief Draws font glyph with one spacing row below
+    /// @param x Relative X coordinate
+    /// @param y Relative Y coordinate
+    /// @param columns Glyph column bytes (bit 0 is top pixel)
+    /// @param glyph_width Glyph width in columns
+    /// @param glyph_height Glyph height in rows
+    inline void glyph(
+        Pixel x, Pixel y,
+        const u8 *columns, u8 glyph_width, u8 glyph_height,
+        ColorType on, ColorType off
+    ) const noexcept {
+        Traits::glyph(buffer, stride, toAbsoluteX(x), toAbsoluteY(y), columns, glyph_width, glyph_height, on, off);
+    }
+
 private:
     /// @brief Converts relative X to absolute buffer coordinate
     kf_nodiscard inline Pixel toAbsoluteX(Pixel x) const noexcept {
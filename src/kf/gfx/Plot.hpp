@@ -0,0 +1,218 @@
+// Copyright (c) 2026 KiraFlux
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cmath>
+
+#include "kf/algorithm.hpp"
+#include "kf/aliases.hpp"
+#include "kf/core/attributes.hpp"
+#include "kf/gfx/Canvas.hpp"
+#include "kf/math/units.hpp"
+#include "kf/memory/Array.hpp"
+
+
+namespace kf::gfx {
+
+/// @brief Scrolling signal plot backed by fixed-size sample ring
+/// @tparam N Sample history capacity
+/// @details Plot sweeps left to right with circular x-origin: each column is drawn once,
+/// a blank erase column runs ahead of the newest one. Column shows min/max of its samples
+/// (decimation when samples outnumber pixels) joined to the previous sample.
+/// Whole area is redrawn from history only when layout or Y scale changes.
+template<usize N> struct Plot {
+    static_assert(N > 0, "Plot needs sample storage");
+
+    /// @brief Plot configuration (call invalidate() after changing)
+    struct Config {
+        f32 y_min{0};                 ///< Lower bound of fixed Y scale
+        f32 y_max{1};                 ///< Upper bound of fixed Y scale
+        u16 samples_per_column{0};    ///< Samples merged into one column (0 - fit whole history into width)
+        bool auto_scale{true};        ///< Fit Y scale to samples instead of [y_min, y_max]
+    };
+
+    Config config{};///< Current plot configuration
+
+private:
+    Array<f32, N> samples{};  ///< Sample ring
+    u32 total{0};             ///< Samples pushed since clear (u32: 16-bit usize wraps within minutes)
+    u32 drawn_columns{0};     ///< Columns already on canvas
+    f32 low{0};               ///< Auto scale lower bound
+    f32 high{0};              ///< Auto scale upper bound
+    Pixel last_width{0};      ///< Width of last drawn area
+    Pixel last_height{0};     ///< Height of last drawn area
+    bool redraw_required{true};///< Next draw repaints whole area
+
+public:
+    /// @brief Append sample
+    /// @note Constant time, safe to call at sampling rate between frames.
+    /// Non-finite samples (NaN, infinity) are skipped: they have no place on Y scale
+    void push(f32 sample) noexcept {
+        if (not std::isfinite(sample)) { return; }
+
+        samples[total % N] = sample;
+        total += 1;
+
+        if (not config.auto_scale) { return; }
+
+        if (total == 1) {
+            low = sample;
+            high = sample;
+            redraw_required = true;
+            return;
+        }
+
+        if (sample < low or sample > high) {
+            // Margin keeps slowly drifting signal from rescaling on every sample
+            const auto margin = (kf::max(high, sample) - kf::min(low, sample)) * 0.125f;
+            if (sample < low) { low = sample - margin; }
+            if (sample > high) { high = sample + margin; }
+            redraw_required = true;
+        }
+    }
+
+    /// @brief Remove all samples
+    void clear() noexcept {
+        total = 0;
+        invalidate();
+    }
+
+    /// @brief Repaint whole area on next draw
+    void invalidate() noexcept { redraw_required = true; }
+
+    /// @brief Get number of stored samples
+    kf_nodiscard usize size() const noexcept { return static_cast<usize>(kf::min<u32>(total, N)); }
+
+    /// @brief Get sample history capacity
+    kf_nodiscard static constexpr usize capacity() noexcept { return N; }
+
+    /// @brief Draw samples pushed since last draw
+    /// @param canvas Plot area (must be the same area on each call, or invalidate() before)
+    template<PixelFormat F> void draw(Canvas<F> &canvas) noexcept {
+        if (canvas.width() < 2 or canvas.height() < 1) { return; }
+
+        const auto per_column = samplesPerColumn(canvas.width());
+        const auto completed = total / per_column;
+
+        if (canvas.width() != last_width or canvas.height() != last_height) {
+            last_width = canvas.width();
+            last_height = canvas.height();
+            redraw_required = true;
+        }
+
+        // Undrawn samples already overwritten in ring
+        if (drawn_columns * per_column + N < total) {
+            redraw_required = true;
+        }
+
+        if (redraw_required) { repaint(canvas, per_column, completed); }
+
+        bool rescaled = false;
+        while (drawn_columns < completed) {
+            const auto x = static_cast<Pixel>(drawn_columns % static_cast<u32>(canvas.width()));
+
+            if (x == 0 and config.auto_scale and not rescaled and shrinkScale()) {
+                // Signal settled into smaller range, repaint once per draw at most
+                rescaled = true;
+                repaint(canvas, per_column, completed);
+                continue;
+            }
+
+            drawColumn(canvas, x, drawn_columns * per_column, per_column);
+            drawn_columns += 1;
+        }
+    }
+
+private:
+    kf_nodiscard u32 samplesPerColumn(Pixel width) const noexcept {
+        if (config.samples_per_column > 0) { return config.samples_per_column; }
+        return kf::max<u32>(1, static_cast<u32>((N + static_cast<usize>(width) - 2) / static_cast<usize>(width - 1)));
+    }
+
+    kf_nodiscard f32 scaleLow() const noexcept { return config.auto_scale ? low : config.y_min; }
+
+    kf_nodiscard f32 scaleHigh() const noexcept { return config.auto_scale ? high : config.y_max; }
+
+    /// @brief Map sample value to row
+    kf_nodiscard Pixel toY(f32 value, Pixel max_y) const noexcept {
+        const auto lo = scaleLow();
+        const auto span = scaleHigh() - lo;
+        if (not(span > 0)) { return static_cast<Pixel>(max_y / 2); }
+
+        const auto relative = kf::clamp((value - lo) / span, 0.0f, 1.0f);
+        return static_cast<Pixel>(max_y - static_cast<Pixel>(relative * static_cast<f32>(max_y) + 0.5f));
+    }
+
+    /// @brief Min/max of stored samples
+    void historyRange(f32 &out_low, f32 &out_high) const noexcept {
+        const auto count = size();
+        out_low = samples[0];
+        out_high = samples[0];
+        for (usize i = 1; i < count; i += 1) {
+            out_low = kf::min(out_low, samples[i]);
+            out_high = kf::max(out_high, samples[i]);
+        }
+    }
+
+    /// @brief Fit auto scale to stored samples
+    void refitScale() noexcept {
+        if (not config.auto_scale or total == 0) { return; }
+        historyRange(low, high);
+    }
+
+    /// @brief Shrink auto scale if history fills less than half of it
+    /// @return true if scale changed
+    bool shrinkScale() noexcept {
+        if (total == 0) { return false; }
+
+        f32 history_low;
+        f32 history_high;
+        historyRange(history_low, history_high);
+
+        const auto history_span = history_high - history_low;
+        if (not std::isfinite(history_span) or history_span * 2 >= high - low) { return false; }
+
+        redraw_required = true;
+        return true;
+    }
+
+    /// @brief Clear area and restart drawing from oldest visible column
+    template<PixelFormat F> void repaint(Canvas<F> &canvas, u32 per_column, u32 completed) noexcept {
+        redraw_required = false;
+        refitScale();
+        canvas.fill();
+
+        const u32 oldest = (total > N) ? static_cast<u32>(total - N) : 0;
+        const u32 first_available = (oldest + per_column - 1) / per_column;
+        const auto visible_columns = static_cast<u32>(canvas.maxX());
+        const u32 first_visible = (completed > visible_columns) ? completed - visible_columns : 0;
+        drawn_columns = kf::max(first_available, first_visible);
+    }
+
+    /// @brief Draw one column and clear the erase column ahead of it
+    template<PixelFormat F> void drawColumn(Canvas<F> &canvas, Pixel x, u32 first, u32 count) noexcept {
+        const auto max_y = canvas.maxY();
+        const auto erase_x = static_cast<Pixel>((x == canvas.maxX()) ? 0 : x + 1);
+
+        canvas.swapColors();
+        canvas.line(x, 0, x, max_y);
+        canvas.line(erase_x, 0, erase_x, max_y);
+        canvas.swapColors();
+
+        // Join to previous sample unless it starts new sweep
+        const bool joined = x > 0 and first > 0 and first + N > total;
+        auto y0 = toY(samples[(joined ? first - 1 : first) % N], max_y);
+        auto y1 = y0;
+
+        for (u32 s = first; s < first + count; s += 1) {
+            const auto y = toY(samples[s % N], max_y);
+            y0 = kf::min(y0, y);
+            y1 = kf::max(y1, y);
+        }
+
+        canvas.line(x, y0, x, y1);
+    }
+};
+
+}// namespace kf::gfx
\ No newline at end of file
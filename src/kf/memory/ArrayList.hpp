@@ -10,6 +10,8 @@
 
 namespace kf {
 
+/// @brief Heap-backed dynamic array (std::vector)
+/// @note StaticVector is fixed-capacity alternative with inline storage
 template<typename T, typename Alloc = kf::Allocator<T>> using ArrayList = std::vector<T, Alloc>;
 
 }
@@ -3,12 +3,12 @@
 
 #pragma once
 
-#include <cstdarg>
-
 #include "kf/memory/Array.hpp"
 #include "kf/memory/Slice.hpp"
 #include "kf/memory/StringView.hpp"
 #include "kf/core/attributes.hpp"
+#include "kf/core/number_format.hpp"
+#include "kf/fmt.hpp"
 #include "kf/algorithm.hpp"
 
 
@@ -155,76 +155,75 @@ public:
     /// @brief Append integer to string
     /// @param value Integer value to append
     /// @return Number of characters appended
-    kf_nodiscard usize append(i32 value) noexcept {
-        if (value == 0) {
-            return push('0') ? 1 : 0;
-        }
+    kf_nodiscard constexpr usize append(i32 value) noexcept {
+        char digits[max_integer_chars]{};
+        return append(StringView{digits, formatSigned(digits, value)});
+    }
 
-        usize start_size = size_;
+    /// @brief Append integer right-aligned to minimal width
+    /// @param value Integer value to append
+    /// @param width Minimal number of characters
+    /// @param fill Padding character ('0' pads between sign and digits)
+    /// @return Number of characters appended
+    kf_nodiscard constexpr usize appendPadded(i32 value, u8 width, char fill = ' ') noexcept {
+        char digits[max_integer_chars]{};
+        const auto length = formatSigned(digits, value);
+        StringView text{digits, length};
 
-        // Handle negative numbers
-        if (value < 0) {
+        const usize start_size = size_;
+        if (fill == '0' and value < 0) {
             (void) push('-');
-            value = -value;
+            text.removePrefix(1);
+            width = (width > 0) ? width - 1 : 0;
         }
 
-        // Convert to string in reverse order
-        char digits[12];
-        int digit_count = 0;
-
-        while (value > 0) {
-            digits[digit_count] = char('0' + (value % 10));
-            digit_count += 1;
-            value /= 10;
+        for (usize i = text.size(); i < width; i += 1) {
+            if (not push(fill)) { break; }
         }
+        (void) append(text);
+        return size_ - start_size;
+    }
 
-        // Append in correct order
-        for (auto i = digit_count - 1; i >= 0; --i) {
-            if (not push(digits[i])) { break; }
-        }
+    /// @brief Append unsigned integer in hexadecimal (no prefix)
+    /// @param value Integer value to append
+    /// @param width Minimal number of digits (padded with '0')
+    /// @param upper Use upper case digits
+    /// @return Number of characters appended
+    kf_nodiscard constexpr usize appendHex(u32 value, u8 width = 0, bool upper = false) noexcept {
+        char digits[max_hex_chars]{};
+        const auto length = formatHex(digits, value, upper);
 
+        const usize start_size = size_;
+        for (usize i = length; i < width; i += 1) {
+            if (not push('0')) { break; }
+        }
+        (void) append(StringView{digits, length});
         return size_ - start_size;
     }
 
-
     /// @brief Append floating-point number to string
     /// @param value Floating-point value
     /// @param decimal_places Number of decimal places to show
     /// @return Number of characters appended
     kf_nodiscard usize append(f64 value, u8 decimal_places) noexcept {
-        usize start_size = size_;
-
-        // Handle special cases
-        if (isnan(value)) { return append("nan"); }
-        if (isinf(value)) { return append(value > 0 ? "inf" : "-inf"); }
+        const usize start_size = size_;
 
-        // Handle negative numbers
-        if (value < 0) {
-            (void) push('-');
-            value = -value;
+        // Enough room for any integer part: write straight into buffer
+        if (N - size_ >= max_integer_chars + 1 + decimal_places) {
+            size_ += formatFixed(buffer_.data() + size_, value, decimal_places);
+            buffer_[size_] = '\0';
+            return size_ - start_size;
         }
 
-        // Integer part
-        const auto int_part = static_cast<i32>(value);
-        (void) append(int_part);
-
-        // Decimal part
-        if (decimal_places > 0) {
-            (void) push('.');
-
-            f64 fraction = value - int_part;
-            for (auto i = 0; i < decimal_places; i += 1) {
-                fraction *= 10.0;
-                auto digit = static_cast<u8>(fraction);
-                (void) push('0' + digit);
-                fraction -= digit;
+        char integer[max_integer_chars];
+        (void) append(StringView{integer, formatFixed(integer, value, 0)});
 
-                if (fraction < 1e-12) { // Avoid floating point issues
-                    break;
-                }
-            }
+        // Fraction digits clipped to remaining capacity
+        if (decimal_places > 0 and value - value == 0 and push('.')) {
+            const auto places = static_cast<u8>(min<usize>(decimal_places, N - size_));
+            size_ += formatFraction(buffer_.data() + size_, value, places);
+            buffer_[size_] = '\0';
         }
-
         return size_ - start_size;
     }
 
@@ -273,34 +272,14 @@ public:
         return to_erase;
     }
 
-    /// @brief Format string using printf-style syntax
-    /// @param format Format string
-    /// @param ... Variable arguments matching format specifiers
+    /// @brief Format string from compile-time pattern (replaces contents)
+    /// @param pattern Pattern made by kf_fmt("...") (see kf::fmt::write)
+    /// @param args Arguments matching pattern conversions
     /// @return Number of characters written (excluding null terminator)
     /// @note Always null-terminates the result
-    kf_nodiscard usize format(const char *format, ...) noexcept {
-        if (N == 0) {
-            buffer_[0] = '\0';
-            return 0;
-        }
-
-        va_list args;
-        va_start(args, format);
-
-        // Use vsnprintf for safe formatting
-        const int result = vsnprintf(buffer_.data(), N + 1, format, args);
-
-        va_end(args);
-
-        if (result < 0) {
-            // Formatting error
-            size_ = 0;
-            buffer_[0] = '\0';
-            return 0;
-        }
-
-        size_ = min(static_cast<usize>(result), N);
-        buffer_[size_] = '\0';  // vsnprintf already null-terminates, but be safe
+    template<typename P, typename... Args> kf_nodiscard usize format(P pattern, const Args &...args) noexcept {
+        size_ = fmt::write(Slice<char>{buffer_.data(), N}, pattern, args...);
+        buffer_[size_] = '\0';
         return size_;
     }
 
@@ -345,12 +324,7 @@ public:
     /// @param pos Starting position
     /// @return Option containing position of character if found
     kf_nodiscard constexpr Option<usize> find(char ch, usize pos = 0) const noexcept {
-        for (usize i = pos; i < size_; ++i) {
-            if (buffer_[i] == ch) {
-                return i;
-            }
-        }
-        return {};
+        return view().find(ch, pos);
     }
 
     /// @brief Find substring in string
@@ -358,23 +332,7 @@ public:
     /// @param pos Starting position
     /// @return Option containing position of substring if found
     kf_nodiscard constexpr Option<usize> find(StringView str, usize pos = 0) const noexcept {
-        if (str.size() > size_ or pos > size_ - str.size()) {
-            return {};
-        }
-
-        for (usize i = pos; i <= size_ - str.size(); ++i) {
-            bool found = true;
-            for (usize j = 0; j < str.size(); ++j) {
-                if (buffer_[i + j] != str[j]) {
-                    found = false;
-                    break;
-                }
-            }
-            if (found) {
-                return i;
-            }
-        }
-        return {};
+        return view().find(str, pos);
     }
 
     /// @brief Check if string starts with prefix
@@ -0,0 +1,17 @@
+// Copyright (c) 2026 KiraFlux
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "kf/aliases.hpp"
+
+
+namespace kf {
+
+/// @brief Fixed-capacity container operation error
+enum class ContainerError : u8 {
+    Full,     ///< Capacity exhausted, item not added
+    KeyExists,///< Key already present, value left unchanged
+};
+
+}// namespace kf
\ No newline at end of file
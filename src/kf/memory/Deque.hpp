@@ -9,6 +9,8 @@
 
 namespace kf {
 
+/// @brief Heap-backed double-ended queue (std::deque)
+/// @note RingQueue is fixed-capacity alternative with inline storage
 template<typename T, typename Alloc = kf::Allocator<T>> using Deque = std::deque<T, Alloc>;
 
 }
\ No newline at end of file
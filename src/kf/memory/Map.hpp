@@ -15,7 +15,8 @@ namespace kf {
 /// @tparam V Value type
 /// @tparam C Comparison function object type (default: std::less<K>)
 /// @tparam A Allocator type (default: Allocator<std::pair<K, V>>)
-/// @note Wrapper around std::map for platforms with standard library support
+/// @note Wrapper around std::map for platforms with standard library support,
+/// StaticMap is fixed-capacity alternative with inline storage
 template<typename K, typename V, typename C = std::less<K>, typename A = Allocator<std::pair<K, V>>>
 using Map = std::map<K, V, C, A>;
 
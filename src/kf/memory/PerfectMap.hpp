@@ -0,0 +1,174 @@
+// Copyright (c) 2026 KiraFlux
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "kf/Option.hpp"
+#include "kf/aliases.hpp"
+#include "kf/core/attributes.hpp"
+#include "kf/core/hash.hpp"
+#include "kf/memory/Array.hpp"
+#include "kf/memory/StringView.hpp"
+
+
+namespace kf {
+
+/// @brief Reached when PerfectMap keys are duplicated or cannot be separated
+/// @note Not constexpr on purpose: compile-time construction fails with this function in diagnostic
+inline void perfectMapBuildFailed() noexcept {}
+
+/// @brief Constant-time string-keyed map with collision-free table built at compile time
+/// @tparam V Value type (default constructible literal type, e.g. enum, number, function pointer)
+/// @tparam N Number of keys
+/// @details Hash and displace scheme: key FNV-1a hash picks bucket, bucket seed displaces
+/// its keys into distinct table slots. Lookup costs one hash pass, two integer mixes and one
+/// key comparison regardless of N. Declare instance static constexpr to keep it in flash.
+/// @code
+/// static constexpr auto commands = kf::makePerfectMap<Command>({
+///     {"help", Command::Help},
+///     {"reset", Command::Reset},
+/// });
+/// const auto command = commands.find(line);
+/// @endcode
+template<typename V, usize N> struct PerfectMap {
+    static_assert(N > 0, "PerfectMap needs keys");
+
+    /// @brief Key and value pair
+    struct Item {
+        StringView key;///< Key (must remain valid, e.g. string literal)
+        V value;       ///< Value
+    };
+
+private:
+    static constexpr usize powerOfTwoAtLeast(usize n) noexcept {
+        usize result = 1;
+        while (result < n) { result *= 2; }
+        return result;
+    }
+
+    /// @brief Table slots (load factor above 0.5)
+    static constexpr usize slots_count{powerOfTwoAtLeast(N)};
+    static_assert(slots_count <= 0x10000, "Slot index is taken from 16 hash bits");
+
+    /// @brief Displacement buckets (two keys per bucket on average)
+    static constexpr usize buckets_count{(slots_count >= 2) ? slots_count / 2 : 1};
+
+    /// @brief Maximal bucket seed
+    static constexpr u32 max_seed{0xFFFF};
+
+    Array<Item, slots_count> slots{};  ///< Items by slot (empty slot key has no data)
+    Array<u16, buckets_count> seeds{}; ///< Displacement seed by bucket
+    bool valid_{false};
+
+public:
+    /// @brief Build map from items
+    /// @note Duplicated keys (or keys with equal 32-bit hash) fail compile-time construction
+    explicit constexpr PerfectMap(const Item (&items)[N]) noexcept {
+        u32 hashes[N]{};
+        usize buckets[N]{};
+        usize bucket_sizes[buckets_count]{};
+        bool taken[slots_count]{};
+
+        for (usize i = 0; i < N; i += 1) {
+            hashes[i] = fnv1a(items[i].key);
+            buckets[i] = bucketIndex(hashes[i]);
+            bucket_sizes[buckets[i]] += 1;
+
+            for (usize j = 0; j < i; j += 1) {
+                if (hashes[j] == hashes[i]) {
+                    perfectMapBuildFailed();
+                    return;
+                }
+            }
+        }
+
+        // Largest buckets first, while most slots are free
+        for (usize size = N; size > 0; size -= 1) {
+            for (usize bucket = 0; bucket < buckets_count; bucket += 1) {
+                if (bucket_sizes[bucket] != size) { continue; }
+
+                const auto seed = findSeed(hashes, buckets, bucket, taken);
+                if (seed > max_seed) {
+                    perfectMapBuildFailed();
+                    return;
+                }
+
+                seeds[bucket] = static_cast<u16>(seed);
+                for (usize i = 0; i < N; i += 1) {
+                    if (buckets[i] != bucket) { continue; }
+                    const auto slot = slotIndex(hashes[i], seed);
+                    slots[slot] = items[i];
+                    taken[slot] = true;
+                }
+            }
+        }
+
+        valid_ = true;
+    }
+
+    /// @brief Find value by key
+    /// @return Option containing value if key is present, empty otherwise
+    kf_nodiscard constexpr Option<V> find(StringView key) const noexcept {
+        const auto h = fnv1a(key);
+        const auto &item = slots[slotIndex(h, seeds[bucketIndex(h)])];
+        if (item.key.data() == nullptr or item.key != key) { return {}; }
+        return item.value;
+    }
+
+    /// @brief Check if key is present
+    kf_nodiscard constexpr bool contains(StringView key) const noexcept {
+        return find(key).hasValue();
+    }
+
+    /// @brief Check if construction succeeded (always true for compile-time instances)
+    kf_nodiscard constexpr bool valid() const noexcept { return valid_; }
+
+    /// @brief Get number of keys
+    kf_nodiscard static constexpr usize size() noexcept { return N; }
+
+private:
+    /// @brief Bucket from hash low bits
+    kf_nodiscard static constexpr usize bucketIndex(u32 hash) noexcept {
+        return hash & (buckets_count - 1);
+    }
+
+    /// @brief Slot from high bits of seeded multiplicative hash
+    kf_nodiscard static constexpr usize slotIndex(u32 hash, u32 seed) noexcept {
+        return static_cast<usize>(((hash ^ (seed * 0x9E3779B9u)) * 0x85EBCA6Bu) >> 16) & (slots_count - 1);
+    }
+
+    /// @brief Find seed placing all keys of bucket into distinct free slots
+    /// @return Seed or value above max_seed if none
+    static constexpr u32 findSeed(const u32 (&hashes)[N], const usize (&buckets)[N], usize bucket,
+                                  const bool (&taken)[slots_count]) noexcept {
+        for (u32 seed = 1; seed <= max_seed; seed += 1) {
+            usize used[N]{};
+            usize used_count = 0;
+            bool fits = true;
+
+            for (usize i = 0; i < N and fits; i += 1) {
+                if (buckets[i] != bucket) { continue; }
+
+                const auto slot = slotIndex(hashes[i], seed);
+                fits = not taken[slot];
+                for (usize k = 0; k < used_count and fits; k += 1) {
+                    fits = used[k] != slot;
+                }
+                used[used_count] = slot;
+                used_count += 1;
+            }
+
+            if (fits) { return seed; }
+        }
+        return max_seed + 1;
+    }
+};
+
+/// @brief Build PerfectMap deducing key count
+/// @tparam V Value type
+/// @param items Key and value pairs
+template<typename V, usize N> constexpr PerfectMap<V, N> makePerfectMap(const typename PerfectMap<V, N>::Item (&items)[N]) noexcept {
+    return PerfectMap<V, N>{items};
+}
+
+}// namespace kf
\ No newline at end of file
@@ -13,7 +13,8 @@ namespace kf {
 /// @brief FIFO (first-in, first-out) queue adapter
 /// @tparam T Element type
 /// @tparam Container Underlying container type (default: kf::Deque<T>)
-/// @note Wrapper around std::queue for platforms with standard library support
+/// @note Wrapper around std::queue for platforms with standard library support,
+/// RingQueue is fixed-capacity alternative with inline storage
 template<typename T, typename Container = kf::Deque<T>> using Queue = std::queue<T, Container>;
 
 }
\ No newline at end of file
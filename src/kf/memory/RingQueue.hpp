@@ -0,0 +1,154 @@
+// Copyright (c) 2026 KiraFlux
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "kf/Result.hpp"
+#include "kf/aliases.hpp"
+#include "kf/core/attributes.hpp"
+#include "kf/memory/ContainerError.hpp"
+
+
+namespace kf {
+
+/// @brief Double-ended queue over inline ring buffer with compile-time capacity (never allocates)
+/// @tparam T Item type
+/// @tparam N Capacity in items
+/// @note Subset of std::deque and std::queue interface (Deque, Queue), growth reports ContainerError::Full.
+/// Not thread-safe: use SpscQueue between interrupt and main context.
+template<typename T, usize N> struct RingQueue {
+    static_assert(N > 0, "RingQueue needs capacity");
+
+    using value_type = T;///< Item type
+
+private:
+    alignas(T) unsigned char storage[sizeof(T) * N];
+    usize head{0};///< Position of front item
+    usize size_{0};
+
+public:
+    RingQueue() noexcept = default;
+
+    RingQueue(const RingQueue &other) noexcept(std::is_nothrow_copy_constructible<T>::value) {
+        for (usize i = 0; i < other.size_; i += 1) { new(slot(size_)) T(other[i]); size_ += 1; }
+    }
+
+    RingQueue(RingQueue &&other) noexcept(std::is_nothrow_move_constructible<T>::value) {
+        for (usize i = 0; i < other.size_; i += 1) { new(slot(size_)) T(std::move(other[i])); size_ += 1; }
+        other.clear();
+    }
+
+    RingQueue &operator=(const RingQueue &other) noexcept(std::is_nothrow_copy_constructible<T>::value) {
+        if (this != &other) {
+            clear();
+            for (usize i = 0; i < other.size_; i += 1) { new(slot(size_)) T(other[i]); size_ += 1; }
+        }
+        return *this;
+    }
+
+    RingQueue &operator=(RingQueue &&other) noexcept(std::is_nothrow_move_constructible<T>::value) {
+        if (this != &other) {
+            clear();
+            for (usize i = 0; i < other.size_; i += 1) { new(slot(size_)) T(std::move(other[i])); size_ += 1; }
+            other.clear();
+        }
+        return *this;
+    }
+
+    ~RingQueue() noexcept { clear(); }
+
+    /// @brief Append item at back (std::queue::push)
+    kf_nodiscard Result<void, ContainerError> push(T item) noexcept { return emplace_back(std::move(item)); }
+
+    /// @brief Append item at back
+    kf_nodiscard Result<void, ContainerError> push_back(T item) noexcept { return emplace_back(std::move(item)); }
+
+    /// @brief Construct item at back
+    template<typename... Args> kf_nodiscard Result<void, ContainerError> emplace_back(Args &&...args) noexcept {
+        if (full()) { return {ContainerError::Full}; }
+        new(slot(size_)) T(std::forward<Args>(args)...);
+        size_ += 1;
+        return {};
+    }
+
+    /// @brief Prepend item at front
+    kf_nodiscard Result<void, ContainerError> push_front(T item) noexcept {
+        if (full()) { return {ContainerError::Full}; }
+        head = (head == 0) ? N - 1 : head - 1;
+        new(slot(0)) T(std::move(item));
+        size_ += 1;
+        return {};
+    }
+
+    /// @brief Remove front item (std::queue::pop, no-op if empty)
+    void pop() noexcept { pop_front(); }
+
+    /// @brief Remove front item (no-op if empty)
+    void pop_front() noexcept {
+        if (empty()) { return; }
+        slot(0)->~T();
+        head = (head + 1 == N) ? 0 : head + 1;
+        size_ -= 1;
+    }
+
+    /// @brief Remove back item (no-op if empty)
+    void pop_back() noexcept {
+        if (empty()) { return; }
+        size_ -= 1;
+        slot(size_)->~T();
+    }
+
+    /// @brief Remove all items
+    void clear() noexcept {
+        while (not empty()) { pop_back(); }
+        head = 0;
+    }
+
+    /// @brief Get item by position from front (no bounds checking)
+    kf_nodiscard T &operator[](usize index) noexcept { return *slot(index); }
+
+    /// @brief Get item by position from front (no bounds checking)
+    kf_nodiscard const T &operator[](usize index) const noexcept { return *slot(index); }
+
+    /// @brief Get front item (must not be empty)
+    kf_nodiscard T &front() noexcept { return *slot(0); }
+
+    /// @brief Get front item (must not be empty)
+    kf_nodiscard const T &front() const noexcept { return *slot(0); }
+
+    /// @brief Get back item (must not be empty)
+    kf_nodiscard T &back() noexcept { return *slot(size_ - 1); }
+
+    /// @brief Get back item (must not be empty)
+    kf_nodiscard const T &back() const noexcept { return *slot(size_ - 1); }
+
+    /// @brief Get number of items
+    kf_nodiscard usize size() const noexcept { return size_; }
+
+    /// @brief Get capacity in items
+    kf_nodiscard static constexpr usize capacity() noexcept { return N; }
+
+    /// @brief Check if queue has no items
+    kf_nodiscard bool empty() const noexcept { return size_ == 0; }
+
+    /// @brief Check if queue is at capacity
+    kf_nodiscard bool full() const noexcept { return size_ == N; }
+
+private:
+    /// @brief Get storage of item by position from front
+    kf_nodiscard T *slot(usize index) noexcept {
+        const auto position = head + index;
+        return reinterpret_cast<T *>(storage) + (position >= N ? position - N : position);
+    }
+
+    kf_nodiscard const T *slot(usize index) const noexcept {
+        const auto position = head + index;
+        return reinterpret_cast<const T *>(storage) + (position >= N ? position - N : position);
+    }
+};
+
+}// namespace kf
\ No newline at end of file
@@ -0,0 +1,116 @@
+// Copyright (c) 2026 KiraFlux
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <atomic>
+#include <type_traits>
+
+#include "kf/Option.hpp"
+#include "kf/aliases.hpp"
+#include "kf/core/attributes.hpp"
+#include "kf/memory/Array.hpp"
+
+
+namespace kf {
+
+/// @brief Behavior of full SpscQueue on push
+enum class OverflowPolicy : u8 {
+    DropNewest,///< Reject pushed item
+    DropOldest,///< Discard oldest queued item to make room
+};
+
+/// @brief Fixed-capacity lock-free single-producer/single-consumer FIFO queue
+/// @tparam T Item type (small integral type, stored as lock-free atomic)
+/// @tparam N Capacity in items (power of two)
+/// @details Producer may run in interrupt context or on another core.
+/// Storage is embedded, queue never allocates.
+template<typename T, usize N> struct SpscQueue {
+    static_assert(std::is_integral<T>::value, "T must be integral");
+    static_assert(N >= 2 and (N & (N - 1)) == 0, "N must be power of two");
+
+private:
+    static constexpr usize index_mask{N - 1};
+
+    Array<std::atomic<T>, N> slots{};  ///< Item ring
+    std::atomic<usize> head{0};        ///< Next write position (written by producer)
+    std::atomic<usize> tail{0};        ///< Next read position (written by consumer, by producer on DropOldest)
+    std::atomic<u32> dropped_items{0}; ///< Items lost on overflow
+    std::atomic<usize> peak_size{0};   ///< Highest observed queue size
+
+public:
+    OverflowPolicy overflow{OverflowPolicy::DropNewest};///< Overflow policy (set before producer starts)
+
+    /// @brief Enqueue item (producer side)
+    /// @param item Item to enqueue
+    /// @return false if item was rejected by DropNewest policy
+    bool push(T item) noexcept {
+        const auto h = head.load(std::memory_order_relaxed);
+        auto t = tail.load(std::memory_order_acquire);
+
+        if (h - t == N) {
+            if (overflow == OverflowPolicy::DropNewest) {
+                dropped_items.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+
+            // Consumer may take oldest item concurrently, room is freed either way
+            if (tail.compare_exchange_strong(t, t + 1, std::memory_order_acq_rel, std::memory_order_acquire)) {
+                dropped_items.fetch_add(1, std::memory_order_relaxed);
+            }
+            t = tail.load(std::memory_order_relaxed);
+        }
+
+        slots[h & index_mask].store(item, std::memory_order_relaxed);
+        head.store(h + 1, std::memory_order_release);
+
+        const auto size = h + 1 - t;
+        if (size > peak_size.load(std::memory_order_relaxed)) {
+            peak_size.store(size, std::memory_order_relaxed);
+        }
+        return true;
+    }
+
+    /// @brief Dequeue oldest item (consumer side)
+    /// @return Oldest item, empty if queue is empty
+    kf_nodiscard Option<T> pop() noexcept {
+        auto t = tail.load(std::memory_order_relaxed);
+
+        while (t != head.load(std::memory_order_acquire)) {
+            const T item = slots[t & index_mask].load(std::memory_order_relaxed);
+
+            // Fails only if producer discarded this item by DropOldest policy
+            if (tail.compare_exchange_weak(t, t + 1, std::memory_order_release, std::memory_order_relaxed)) {
+                return {item};
+            }
+        }
+        return {};
+    }
+
+    /// @brief Check if queue has no items (approximate while producer is active)
+    kf_nodiscard bool empty() const noexcept {
+        return head.load(std::memory_order_acquire) == tail.load(std::memory_order_acquire);
+    }
+
+    /// @brief Get current item count (approximate while producer is active)
+    kf_nodiscard usize size() const noexcept {
+        return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire);
+    }
+
+    /// @brief Get queue capacity
+    kf_nodiscard static constexpr usize capacity() noexcept { return N; }
+
+    /// @brief Get number of items lost on overflow
+    kf_nodiscard u32 dropped() const noexcept { return dropped_items.load(std::memory_order_relaxed); }
+
+    /// @brief Get highest observed queue size
+    kf_nodiscard usize peak() const noexcept { return peak_size.load(std::memory_order_relaxed); }
+
+    /// @brief Reset overflow counters
+    void resetStats() noexcept {
+        dropped_items.store(0, std::memory_order_relaxed);
+        peak_size.store(0, std::memory_order_relaxed);
+    }
+};
+
+}// namespace kf
\ No newline at end of file
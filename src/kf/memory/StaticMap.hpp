@@ -0,0 +1,129 @@
+// Copyright (c) 2026 KiraFlux
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <functional>
+#include <utility>
+
+#include "kf/Result.hpp"
+#include "kf/aliases.hpp"
+#include "kf/core/attributes.hpp"
+#include "kf/memory/ContainerError.hpp"
+#include "kf/memory/StaticVector.hpp"
+
+
+namespace kf {
+
+/// @brief Ordered map over inline sorted array with compile-time capacity (never allocates)
+/// @tparam K Key type (must be comparable)
+/// @tparam V Value type
+/// @tparam N Capacity in entries
+/// @tparam C Comparison function object type
+/// @note Subset of std::map interface (Map): lookup is binary search, insert and erase shift entries.
+/// Suits small maps (tens of entries) of peers, handlers, settings.
+template<typename K, typename V, usize N, typename C = std::less<K>> struct StaticMap {
+    using key_type = K;                       ///< Key type
+    using mapped_type = V;                    ///< Value type
+    using value_type = std::pair<K, V>;       ///< Entry type
+    using iterator = value_type *;            ///< Mutable iterator
+    using const_iterator = const value_type *;///< Const iterator
+
+private:
+    StaticVector<value_type, N> entries{};
+    C compare{};
+
+public:
+    /// @brief Insert entry
+    /// @return ContainerError::KeyExists (value unchanged) or ContainerError::Full on failure
+    kf_nodiscard Result<void, ContainerError> insert(value_type entry) noexcept {
+        const auto position = lowerBound(entry.first);
+        if (position != end() and not compare(entry.first, position->first)) { return {ContainerError::KeyExists}; }
+        return entries.insert(position, std::move(entry));
+    }
+
+    /// @brief Insert entry constructed from key and value
+    template<typename... Args> kf_nodiscard Result<void, ContainerError> emplace(const K &key, Args &&...args) noexcept {
+        return insert(value_type{key, V(std::forward<Args>(args)...)});
+    }
+
+    /// @brief Find entry by key
+    /// @return Iterator to entry or end() if absent
+    kf_nodiscard iterator find(const K &key) noexcept {
+        const auto position = lowerBound(key);
+        if (position == end() or compare(key, position->first)) { return end(); }
+        return position;
+    }
+
+    /// @brief Find entry by key
+    /// @return Iterator to entry or end() if absent
+    kf_nodiscard const_iterator find(const K &key) const noexcept {
+        return const_cast<StaticMap *>(this)->find(key);
+    }
+
+    /// @brief Check if key is present
+    kf_nodiscard bool contains(const K &key) const noexcept { return find(key) != end(); }
+
+    /// @brief Get number of entries with key (0 or 1)
+    kf_nodiscard usize count(const K &key) const noexcept { return contains(key) ? 1 : 0; }
+
+    /// @brief Remove entry by key
+    /// @return Number of removed entries (0 or 1)
+    usize erase(const K &key) noexcept {
+        const auto position = find(key);
+        if (position == end()) { return 0; }
+        entries.erase(position);
+        return 1;
+    }
+
+    /// @brief Remove entry at position
+    /// @return Iterator to entry following removed one
+    iterator erase(const_iterator position) noexcept { return entries.erase(position); }
+
+    /// @brief Remove all entries
+    void clear() noexcept { entries.clear(); }
+
+    /// @brief Get iterator to first entry (entries are ordered by key)
+    kf_nodiscard iterator begin() noexcept { return entries.begin(); }
+
+    /// @brief Get iterator to end
+    kf_nodiscard iterator end() noexcept { return entries.end(); }
+
+    /// @brief Get iterator to first entry (entries are ordered by key)
+    kf_nodiscard const_iterator begin() const noexcept { return entries.begin(); }
+
+    /// @brief Get iterator to end
+    kf_nodiscard const_iterator end() const noexcept { return entries.end(); }
+
+    /// @brief Get number of entries
+    kf_nodiscard usize size() const noexcept { return entries.size(); }
+
+    /// @brief Get capacity in entries
+    kf_nodiscard static constexpr usize capacity() noexcept { return N; }
+
+    /// @brief Check if map has no entries
+    kf_nodiscard bool empty() const noexcept { return entries.empty(); }
+
+    /// @brief Check if map is at capacity
+    kf_nodiscard bool full() const noexcept { return entries.full(); }
+
+private:
+    /// @brief First entry with key not less than given
+    kf_nodiscard iterator lowerBound(const K &key) noexcept {
+        iterator first = begin();
+        usize count = size();
+
+        while (count > 0) {
+            const usize half = count / 2;
+            if (compare(first[half].first, key)) {
+                first += half + 1;
+                count -= half + 1;
+            } else {
+                count = half;
+            }
+        }
+        return first;
+    }
+};
+
+}// namespace kf
\ No newline at end of file
@@ -0,0 +1,166 @@
+// Copyright (c) 2026 KiraFlux
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "kf/Result.hpp"
+#include "kf/aliases.hpp"
+#include "kf/core/attributes.hpp"
+#include "kf/memory/ContainerError.hpp"
+
+
+namespace kf {
+
+/// @brief Vector with inline storage and compile-time capacity (never allocates)
+/// @tparam T Item type
+/// @tparam N Capacity in items
+/// @note Subset of std::vector interface (ArrayList), growth reports ContainerError::Full instead of allocating
+template<typename T, usize N> struct StaticVector {
+    static_assert(N > 0, "StaticVector needs capacity");
+
+    using value_type = T;            ///< Item type
+    using iterator = T *;            ///< Mutable iterator
+    using const_iterator = const T *;///< Const iterator
+
+private:
+    alignas(T) unsigned char storage[sizeof(T) * N];
+    usize size_{0};
+
+public:
+    StaticVector() noexcept = default;
+
+    StaticVector(const StaticVector &other) noexcept(std::is_nothrow_copy_constructible<T>::value) {
+        for (const auto &item: other) { new(end()) T(item); size_ += 1; }
+    }
+
+    StaticVector(StaticVector &&other) noexcept(std::is_nothrow_move_constructible<T>::value) {
+        for (auto &item: other) { new(end()) T(std::move(item)); size_ += 1; }
+        other.clear();
+    }
+
+    StaticVector &operator=(const StaticVector &other) noexcept(std::is_nothrow_copy_constructible<T>::value) {
+        if (this != &other) {
+            clear();
+            for (const auto &item: other) { new(end()) T(item); size_ += 1; }
+        }
+        return *this;
+    }
+
+    StaticVector &operator=(StaticVector &&other) noexcept(std::is_nothrow_move_constructible<T>::value) {
+        if (this != &other) {
+            clear();
+            for (auto &item: other) { new(end()) T(std::move(item)); size_ += 1; }
+            other.clear();
+        }
+        return *this;
+    }
+
+    ~StaticVector() noexcept { clear(); }
+
+    /// @brief Append copy of item
+    kf_nodiscard Result<void, ContainerError> push_back(const T &item) noexcept { return emplace_back(item); }
+
+    /// @brief Append item
+    kf_nodiscard Result<void, ContainerError> push_back(T &&item) noexcept { return emplace_back(std::move(item)); }
+
+    /// @brief Construct item at end
+    template<typename... Args> kf_nodiscard Result<void, ContainerError> emplace_back(Args &&...args) noexcept {
+        if (full()) { return {ContainerError::Full}; }
+        new(end()) T(std::forward<Args>(args)...);
+        size_ += 1;
+        return {};
+    }
+
+    /// @brief Insert item before position (later items are shifted)
+    kf_nodiscard Result<void, ContainerError> insert(const_iterator position, T item) noexcept {
+        if (full()) { return {ContainerError::Full}; }
+
+        const auto index = static_cast<usize>(position - begin());
+        if (index == size_) { return emplace_back(std::move(item)); }
+
+        new(end()) T(std::move(back()));
+        for (usize i = size_ - 1; i > index; i -= 1) {
+            data()[i] = std::move(data()[i - 1]);
+        }
+        data()[index] = std::move(item);
+        size_ += 1;
+        return {};
+    }
+
+    /// @brief Remove item at position (later items are shifted)
+    /// @return Iterator to item following removed one
+    iterator erase(const_iterator position) noexcept {
+        const auto index = static_cast<usize>(position - begin());
+        for (usize i = index; i + 1 < size_; i += 1) {
+            data()[i] = std::move(data()[i + 1]);
+        }
+        pop_back();
+        return begin() + index;
+    }
+
+    /// @brief Remove last item (no-op if empty)
+    void pop_back() noexcept {
+        if (empty()) { return; }
+        size_ -= 1;
+        end()->~T();
+    }
+
+    /// @brief Remove all items
+    void clear() noexcept {
+        while (not empty()) { pop_back(); }
+    }
+
+    /// @brief Get item by index (no bounds checking)
+    kf_nodiscard T &operator[](usize index) noexcept { return data()[index]; }
+
+    /// @brief Get item by index (no bounds checking)
+    kf_nodiscard const T &operator[](usize index) const noexcept { return data()[index]; }
+
+    /// @brief Get first item (must not be empty)
+    kf_nodiscard T &front() noexcept { return data()[0]; }
+
+    /// @brief Get first item (must not be empty)
+    kf_nodiscard const T &front() const noexcept { return data()[0]; }
+
+    /// @brief Get last item (must not be empty)
+    kf_nodiscard T &back() noexcept { return data()[size_ - 1]; }
+
+    /// @brief Get last item (must not be empty)
+    kf_nodiscard const T &back() const noexcept { return data()[size_ - 1]; }
+
+    /// @brief Get pointer to items
+    kf_nodiscard T *data() noexcept { return reinterpret_cast<T *>(storage); }
+
+    /// @brief Get pointer to items
+    kf_nodiscard const T *data() const noexcept { return reinterpret_cast<const T *>(storage); }
+
+    /// @brief Get iterator to beginning
+    kf_nodiscard iterator begin() noexcept { return data(); }
+
+    /// @brief Get iterator to end
+    kf_nodiscard iterator end() noexcept { return data() + size_; }
+
+    /// @brief Get iterator to beginning
+    kf_nodiscard const_iterator begin() const noexcept { return data(); }
+
+    /// @brief Get iterator to end
+    kf_nodiscard const_iterator end() const noexcept { return data() + size_; }
+
+    /// @brief Get number of items
+    kf_nodiscard usize size() const noexcept { return size_; }
+
+    /// @brief Get capacity in items
+    kf_nodiscard static constexpr usize capacity() noexcept { return N; }
+
+    /// @brief Check if vector has no items
+    kf_nodiscard bool empty() const noexcept { return size_ == 0; }
+
+    /// @brief Check if vector is at capacity
+    kf_nodiscard bool full() const noexcept { return size_ == N; }
+};
+
+}// namespace kf
\ No newline at end of file
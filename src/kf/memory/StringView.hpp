@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <cstdint>
+#include <cstring>
 #include <type_traits>
 
 #include "kf/memory/Slice.hpp"
@@ -105,10 +107,7 @@ public:
     /// @return true if string starts with prefix
     kf_nodiscard constexpr bool startsWith(StringView prefix) const noexcept {
         if (prefix.size() > size_) { return false; }
-        for (usize i = 0; i < prefix.size(); ++i) {
-            if (data_[i] != prefix[i]) { return false; }
-        }
-        return true;
+        return equalBytes(data_, prefix.data_, prefix.size_);
     }
 
     /// @brief Check if string ends with suffix
@@ -116,23 +115,16 @@ public:
     /// @return true if string ends with suffix
     kf_nodiscard constexpr bool endsWith(StringView suffix) const noexcept {
         if (suffix.size() > size_) { return false; }
-        const usize offset = size_ - suffix.size();
-        for (usize i = 0; i < suffix.size(); ++i) {
-            if (data_[offset + i] != suffix[i]) { return false; }
-        }
-        return true;
+        return equalBytes(data_ + size_ - suffix.size_, suffix.data_, suffix.size_);
     }
 
     /// @brief Compare with another string view
     /// @param other String to compare with
     /// @return Negative if less, zero if equal, positive if greater
+    /// @note Bytes compare as unsigned (as memcmp and std::string_view, UTF-8 sorts by code point)
     kf_nodiscard constexpr int compare(StringView other) const noexcept {
-        const usize min_size = min(size_, other.size_);
-        for (usize i = 0; i < min_size; ++i) {
-            if (data_[i] != other.data_[i]) {
-                return static_cast<int>(data_[i]) - static_cast<int>(other.data_[i]);
-            }
-        }
+        const int result = compareBytes(data_, other.data_, min(size_, other.size_));
+        if (result != 0) { return result; }
         return static_cast<int>(size_) - static_cast<int>(other.size_);
     }
 
@@ -141,27 +133,27 @@ public:
     /// @param pos Starting position
     /// @return Option containing position of character if found, empty otherwise
     kf_nodiscard constexpr Option<usize> find(char ch, usize pos = 0) const noexcept {
-        for (usize i = pos; i < size_; ++i) {
-            if (data_[i] == ch) { return i; }
-        }
-        return {};
+        const usize index = indexOf(ch, pos);
+        if (index == size_) { return {}; }
+        return index;
     }
 
     /// @brief Find substring
     /// @param str Substring to find
     /// @param pos Starting position
     /// @return Option containing position of substring if found, empty otherwise
+    /// @note Long needles in long strings use Horspool skip table, others scan for first character (memchr at runtime)
     kf_nodiscard constexpr Option<usize> find(StringView str, usize pos = 0) const noexcept {
         if (str.size() > size_ or pos > size_ - str.size()) { return {}; }
-        for (usize i = pos; i <= size_ - str.size(); ++i) {
-            bool found = true;
-            for (usize j = 0; j < str.size(); ++j) {
-                if (data_[i + j] != str[j]) {
-                    found = false;
-                    break;
-                }
-            }
-            if (found) { return i; }
+        if (str.empty()) { return pos; }
+
+        if (str.size() >= horspool_min_needle and size_ - pos >= horspool_min_haystack) {
+            return findHorspool(str, pos);
+        }
+
+        const usize last = size_ - str.size();
+        for (usize i = indexOf(str.data_[0], pos); i <= last; i = indexOf(str.data_[0], i + 1)) {
+            if (equalBytes(data_ + i + 1, str.data_ + 1, str.size_ - 1)) { return i; }
         }
         return {};
     }
@@ -173,9 +165,14 @@ public:
     kf_nodiscard constexpr Option<usize> rfind(char ch, usize pos = static_cast<usize>(-1)) const noexcept {
         if (size_ == 0) { return {}; }
 
-        usize start = (pos >= size_) ? size_ - 1 : pos;
-        for (usize i = start; i != static_cast<usize>(-1); --i) {
-            if (data_[i] == ch) { return i; }
+        usize end = (pos >= size_) ? size_ : pos + 1;
+
+        if (not kf_is_constant_evaluated()) {
+            end = skipWordsWithout(data_, end, ch);
+        }
+
+        for (usize i = end; i > 0; --i) {
+            if (data_[i - 1] == ch) { return i - 1; }
         }
         return {};
     }
@@ -219,6 +216,105 @@ public:
     }
 
 private:
+    /// @brief Minimal needle size for Horspool search
+    static constexpr usize horspool_min_needle{8};
+
+    /// @brief Minimal searched size for Horspool search (shorter strings do not repay skip table setup)
+    static constexpr usize horspool_min_haystack{128};
+
+    /// @brief Minimal size for memchr and memcmp calls (shorter ranges are cheaper inline)
+    static constexpr usize library_call_min_size{16};
+
+    /// @brief Find character position (memchr at runtime)
+    /// @return Position of character, size() if not found
+    constexpr usize indexOf(char ch, usize pos) const noexcept {
+        if (pos >= size_) { return size_; }
+
+        if (size_ - pos >= library_call_min_size and not kf_is_constant_evaluated()) {
+            const auto found = static_cast<const char *>(std::memchr(data_ + pos, ch, size_ - pos));
+            return (found == nullptr) ? size_ : static_cast<usize>(found - data_);
+        }
+
+        for (usize i = pos; i < size_; ++i) {
+            if (data_[i] == ch) { return i; }
+        }
+        return size_;
+    }
+
+    /// @brief Check bytes for equality
+    static constexpr bool equalBytes(const char *a, const char *b, usize size) noexcept {
+        if (size >= library_call_min_size and not kf_is_constant_evaluated()) {
+            return std::memcmp(a, b, size) == 0;
+        }
+
+        for (usize i = 0; i < size; ++i) {
+            if (a[i] != b[i]) { return false; }
+        }
+        return true;
+    }
+
+    /// @brief Compare bytes as unsigned (memcmp at runtime)
+    static constexpr int compareBytes(const char *a, const char *b, usize size) noexcept {
+        if (size >= library_call_min_size and not kf_is_constant_evaluated()) {
+            return std::memcmp(a, b, size);
+        }
+
+        for (usize i = 0; i < size; ++i) {
+            if (a[i] != b[i]) {
+                return static_cast<int>(static_cast<unsigned char>(a[i])) - static_cast<int>(static_cast<unsigned char>(b[i]));
+            }
+        }
+        return 0;
+    }
+
+    /// @brief Skip trailing machine words not containing character
+    /// @param end Exclusive end of searched range
+    /// @return New exclusive end (character, if present, is before it)
+    static usize skipWordsWithout(const char *data, usize end, char ch) noexcept {
+        constexpr usize word = sizeof(usize);
+        constexpr usize ones = ~usize{0} / 0xFF;// 0x0101...
+        constexpr usize highs = ones << 7;      // 0x8080...
+        const usize pattern = ones * static_cast<unsigned char>(ch);
+
+        // Bytes up to word boundary, so word loads are aligned
+        while (end > 0 and reinterpret_cast<uintptr_t>(data + end) % word != 0) {
+            if (data[end - 1] == ch) { return end; }
+            end -= 1;
+        }
+
+        while (end >= word) {
+            usize chunk;
+            std::memcpy(&chunk, __builtin_assume_aligned(data + end - word, word), word);
+            const usize difference = chunk ^ pattern;
+
+            // Some byte of difference is zero
+            if (((difference - ones) & ~difference & highs) != 0) { return end; }
+            end -= word;
+        }
+        return end;
+    }
+
+    /// @brief Boyer-Moore-Horspool substring search
+    constexpr Option<usize> findHorspool(StringView str, usize pos) const noexcept {
+        const usize m = str.size_;
+        const usize max_skip = min<usize>(m, 255);
+
+        // Skip distance by character under needle end
+        u8 skip[256]{};
+        for (auto &s: skip) { s = static_cast<u8>(max_skip); }
+        for (usize i = m - max_skip; i < m - 1; ++i) {
+            skip[static_cast<unsigned char>(str.data_[i])] = static_cast<u8>(m - 1 - i);
+        }
+
+        const char tail = str.data_[m - 1];
+        for (usize i = pos; i <= size_ - m;) {
+            const char c = data_[i + m - 1];
+            if (c == tail and equalBytes(data_ + i, str.data_, m - 1)) { return i; }
+            i += skip[static_cast<unsigned char>(c)];
+        }
+        return {};
+    }
+
     /// @brief Calculate string length (safe for null pointers)
     static constexpr usize calculateSize(const char *str) noexcept {
         if (!str) { return 0; }
@@ -235,12 +331,12 @@ private:
 
 /// @brief Compare string views for equality
 constexpr bool operator==(StringView lhs, StringView rhs) noexcept {
-    return lhs.compare(rhs) == 0;
+    return lhs.size() == rhs.size() and lhs.startsWith(rhs);
 }
 
 /// @brief Compare string views for inequality
 constexpr bool operator!=(StringView lhs, StringView rhs) noexcept {
-    return lhs.compare(rhs) != 0;
+    return not(lhs == rhs);
 }
 
 /// @brief Compare string views for less-than
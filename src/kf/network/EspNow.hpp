@@ -15,8 +15,8 @@
 #include "kf/aliases.hpp"
 #include "kf/core/attributes.hpp"
 #include "kf/memory/Array.hpp"
-#include "kf/memory/Map.hpp"
 #include "kf/memory/Slice.hpp"
+#include "kf/memory/StaticMap.hpp"
 #include "kf/memory/ArrayString.hpp"
 #include "kf/pattern/Singleton.hpp"
 
@@ -120,7 +120,8 @@ struct EspNow : Singleton<EspNow> {
             auto context = espnow.getPeerContext(mac_);
 
             if (nullptr == context) {
-                espnow.peer_contexts.insert({mac_, Context{std::move(handler)}});
+                const auto inserted = espnow.peer_contexts.insert({mac_, Context{std::move(handler)}});
+                if (inserted.isError()) { return {Error::PeerListIsFull}; }
             } else {
                 context->on_receive = std::move(handler);
             }
@@ -177,8 +178,8 @@ struct EspNow : Singleton<EspNow> {
     };
 
 private:
-    Map<Mac, Peer::Context> peer_contexts{};               ///< Map of known peers and their contexts
-    UnknownReceiveHandler unknown_receive_handler{nullptr};///< Handler for unknown peers
+    StaticMap<Mac, Peer::Context, ESP_NOW_MAX_TOTAL_PEER_NUM> peer_contexts{};///< Known peers and their contexts (bounded by ESP-NOW peer limit)
+    UnknownReceiveHandler unknown_receive_handler{nullptr};                   ///< Handler for unknown peers
 
     /// @brief Local device MAC address (cached)
     const Mac mac_{
@@ -289,7 +290,7 @@ public:
     kf_nodiscard static ArrayString<mac_string_size> stringFromMac(const Mac &mac) noexcept {
         ArrayString<mac_string_size> ret{};
         const auto p = mac.data();
-        (void) ret.format("%02x%02x-%02x%02x-%02x%02x", p[0], p[1], p[2], p[3], p[4], p[5]);
+        (void) ret.format(kf_fmt("%02x%02x-%02x%02x-%02x%02x"), p[0], p[1], p[2], p[3], p[4], p[5]);
         return ret;
     }
 
@@ -0,0 +1,236 @@
+// Copyright (c) 2026 KiraFlux
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "kf/Function.hpp"
+#include "kf/aliases.hpp"
+#include "kf/core/PixelFormat.hpp"
+#include "kf/core/attributes.hpp"
+#include "kf/gfx/Canvas.hpp"
+#include "kf/math/units.hpp"
+#include "kf/memory/ArrayString.hpp"
+#include "kf/memory/StringView.hpp"
+#include "kf/ui/Render.hpp"
+
+
+namespace kf {// NOLINT(*-concat-nested-namespaces) // for c++11 capability
+namespace ui {
+
+/// @brief Graphical UI rendering system drawing directly on canvas
+/// @tparam F Pixel format of target canvas
+/// @note Canvas is split into fixed rows: title row followed by widget slots.
+/// Partial frames clear and redraw only emitted slots and report them as dirty regions.
+template<PixelFormat F> struct CanvasRender : Render<CanvasRender<F>> {
+    friend struct Render<CanvasRender<F>>;
+
+    using Canvas = gfx::Canvas<F>;///< Target canvas type
+
+    /// @brief Region changed by frame, relative to canvas origin
+    using DirtyRegionHandler = Function<void(Pixel x, Pixel y, Pixel width, Pixel height)>;
+
+    /// @brief Canvas renderer configuration settings
+    struct Config {
+        Canvas canvas{};                               ///< Target canvas covering whole UI area
+        DirtyRegionHandler on_dirty_region{nullptr};   ///< Invoked on frame finish for each changed region (e.g. display sendRegion)
+        Pixel row_padding{2};                          ///< Extra vertical space of each row in pixels
+        u8 float_places{2};                            ///< Decimal places for float
+        u8 double_places{4};                           ///< Decimal places for double
+        bool title_centered{true};                     ///< Render Title centered
+
+        Config(const Config &) = delete;
+    };
+
+    Config config{};///< Current renderer configuration
+
+private:
+    static constexpr usize max_slots{32};///< Slot count limit (dirty slots are tracked in 32-bit mask)
+
+    Canvas slot{};          ///< Sub-canvas of row being drawn
+    Pixel cursor_x{0};      ///< Drawing position within row
+    Pixel block_x{0};       ///< Start position of current block
+    u32 dirty_slots{0};     ///< Slots drawn in current partial frame
+    bool full_frame{false}; ///< Current frame redraws whole canvas
+
+    kf_nodiscard Pixel rowHeight() const noexcept {
+        return static_cast<Pixel>(config.canvas.glyphHeight() + config.row_padding);
+    }
+
+    kf_nodiscard Pixel textY() const noexcept { return static_cast<Pixel>(config.row_padding / 2); }
+
+    /// @brief Select row as drawing target and clear it
+    void beginRow(usize row) noexcept {
+        slot = config.canvas.subUnchecked(
+            config.canvas.width(), rowHeight(),
+            0, static_cast<Pixel>(row * rowHeight()));
+        slot.fill();
+        cursor_x = 1;
+    }
+
+    /// @brief Write text with cursor tracking
+    void writeString(StringView str) noexcept {
+        cursor_x = slot.text(cursor_x, textY(), str);
+    }
+
+    void writeReal(f64 real, u8 rounding) noexcept {
+        ArrayString<24> temp; // Enough for double with precision
+        (void) temp.append(real, rounding);
+        writeString(temp.view());
+    }
+
+    kf_nodiscard bool isDirty(usize index) const noexcept { return (dirty_slots >> index) & 1u; }
+
+    /// @brief Clamp X coordinate to current row
+    kf_nodiscard Pixel clampX(Pixel x) const noexcept { return kf::min<Pixel>(x, slot.maxX()); }
+
+    // Render Interface Implementation
+
+    /// @brief Canvas keeps previous frame, slots may be redrawn individually
+    kf_nodiscard static constexpr bool partialImpl() noexcept { return true; }
+
+    kf_nodiscard usize widgetsAvailableImpl() const noexcept {
+        const auto rows = static_cast<usize>(config.canvas.height() / rowHeight());
+        return (rows > 1) ? kf::min(rows - 1, max_slots) : 0;
+    }
+
+    void prepareImpl(bool full) noexcept {
+        full_frame = full;
+        dirty_slots = 0;
+
+        if (full) {
+            config.canvas.fill();
+        }
+    }
+
+    void finishImpl() noexcept {
+        if (not config.on_dirty_region) { return; }
+
+        const auto width = config.canvas.width();
+
+        if (full_frame) {
+            config.on_dirty_region(0, 0, width, config.canvas.height());
+            return;
+        }
+
+        // Adjacent slots are reported as single region
+        usize index = 0;
+        while (index < max_slots) {
+            if (not isDirty(index)) {
+                index += 1;
+                continue;
+            }
+
+            const auto first = index;
+            while (index < max_slots and isDirty(index)) { index += 1; }
+
+            config.on_dirty_region(
+                0, static_cast<Pixel>((first + 1) * rowHeight()),
+                width, static_cast<Pixel>((index - first) * rowHeight()));
+        }
+    }
+
+    void titleImpl(StringView title) noexcept {
+        beginRow(0);
+        slot.swapColors();
+        slot.fill();
+
+        if (config.title_centered) {
+            const auto text_width = static_cast<Pixel>(title.size() * slot.glyphWidth());
+            cursor_x = static_cast<Pixel>(kf::max(0, (slot.width() - text_width) / 2));
+        }
+        writeString(title);
+
+        slot.swapColors();
+    }
+
+    void checkboxImpl(bool enabled) noexcept {
+        const auto y0 = textY();
+        const auto size = static_cast<Pixel>(slot.glyphHeight() - 2);
+        const auto x1 = clampX(static_cast<Pixel>(cursor_x + size));
+
+        slot.rect(cursor_x, y0, x1, static_cast<Pixel>(y0 + size), false);
+        if (enabled and size > 3) {
+            slot.rect(
+                static_cast<Pixel>(cursor_x + 2), static_cast<Pixel>(y0 + 2),
+                static_cast<Pixel>(x1 - 2), static_cast<Pixel>(y0 + size - 2), true);
+        }
+
+        cursor_x = clampX(static_cast<Pixel>(x1 + 3));
+    }
+
+    // Value rendering implementations
+    void valueImpl(StringView str) noexcept { writeString(str); }
+
+    void valueImpl(bool value) noexcept { writeString(value ? "true" : "false"); }
+
+    void valueImpl(i32 integer) noexcept {
+        ArrayString<12> temp; // Enough for 32-bit int
+        (void) temp.append(integer);
+        writeString(temp.view());
+    }
+
+    void valueImpl(f32 real) noexcept {
+        writeReal(static_cast<f64>(real), config.float_places);
+    }
+
+    void valueImpl(f64 real) noexcept {
+        writeReal(real, config.double_places);
+    }
+
+    // Decoration rendering
+
+    /// @brief Filled triangle pointing right
+    void arrowImpl() noexcept {
+        const auto y0 = textY();
+        const auto height = static_cast<Pixel>(slot.glyphHeight() - 2);
+
+        for (Pixel i = 0; i <= height / 2; i += 1) {
+            const auto x = clampX(static_cast<Pixel>(cursor_x + i));
+            slot.line(x, static_cast<Pixel>(y0 + i), x, static_cast<Pixel>(y0 + height - i));
+        }
+
+        cursor_x = clampX(static_cast<Pixel>(cursor_x + height / 2 + 3));
+    }
+
+    void colonImpl() noexcept { writeString(": "); }
+
+    /// @brief Invert whole slot
+    void beginFocusedImpl() noexcept {
+        slot.swapColors();
+        slot.fill();
+    }
+
+    void endFocusedImpl() noexcept { slot.swapColors(); }
+
+    /// @brief Outlined frame around block content
+    void beginBlockImpl() noexcept {
+        block_x = cursor_x;
+        cursor_x = clampX(static_cast<Pixel>(cursor_x + 2));
+    }
+
+    void endBlockImpl() noexcept {
+        const auto x1 = clampX(static_cast<Pixel>(cursor_x + 1));
+        slot.rect(block_x, 0, x1, slot.maxY(), false);
+        cursor_x = clampX(static_cast<Pixel>(x1 + 3));
+    }
+
+    /// @brief Underlined block content
+    void beginAltBlockImpl() noexcept { block_x = cursor_x; }
+
+    void endAltBlockImpl() noexcept {
+        if (cursor_x > block_x) {
+            slot.line(block_x, slot.maxY(), static_cast<Pixel>(cursor_x - 1), slot.maxY());
+        }
+        cursor_x = clampX(static_cast<Pixel>(cursor_x + 2));
+    }
+
+    void beginWidgetImpl(usize index) noexcept {
+        beginRow(index + 1);
+        dirty_slots |= u32{1} << index;
+    }
+
+    void endWidgetImpl() noexcept {}
+};
+
+} // namespace ui
+} // namespace kf
\ No newline at end of file
@@ -37,6 +37,10 @@ private:
 
     Storage storage;///< Packed event data (type + value)
 
+    /// @brief Construct event from packed storage
+    constexpr explicit Event(Storage raw) noexcept:
+        storage{raw} {}
+
 public:
     /// @brief Event type identifiers
     enum class Type : Storage {
@@ -54,6 +58,13 @@ public:
                 (static_cast<Storage>(clamp(value, value_min, value_max)) & value_mask))
         } {}
 
+    /// @brief Restore event from packed storage
+    /// @param raw Value previously obtained by raw()
+    kf_nodiscard static constexpr Event fromRaw(Storage raw) noexcept { return Event{raw}; }
+
+    /// @brief Get packed event storage (type and value)
+    kf_nodiscard constexpr Storage raw() const noexcept { return storage; }
+
     /// @brief Get event type
     kf_nodiscard constexpr Type type() const noexcept {
         return static_cast<Type>(storage & type_mask);
@@ -65,6 +76,26 @@ public:
         return (result & sign_bit_mask) ? static_cast<Value>(result | ~value_mask) : result;
     }
 
+    /// @brief Merge following event into this one by summing values
+    /// @param next Event queued right after this one
+    /// @return true if merged, false if types differ, type is WidgetClick,
+    /// WidgetValueChange values differ in sign or sum leaves value range
+    /// @note Merged sum is never clamped, so coalescing loses no input steps.
+    /// Widget values merge only with same sign: widgets may act on sign alone (CheckBox)
+    kf_nodiscard bool merge(Event next) noexcept {
+        if (type() != next.type() or type() == Type::WidgetClick) { return false; }
+
+        const auto a = value();
+        const auto b = next.value();
+        if (type() == Type::WidgetValueChange and not((a > 0 and b > 0) or (a < 0 and b < 0))) { return false; }
+
+        const i32 sum = static_cast<i32>(a) + static_cast<i32>(b);
+        if (sum < value_min or sum > value_max) { return false; }
+
+        storage = Event{type(), static_cast<Value>(sum)}.storage;
+        return true;
+    }
+
     // Predefined event instances
 
     /// @brief Create update event (forces redraw)
@@ -0,0 +1,105 @@
+// Copyright (c) 2026 KiraFlux
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "kf/Function.hpp"
+#include "kf/algorithm.hpp"
+#include "kf/aliases.hpp"
+#include "kf/core/attributes.hpp"
+#include "kf/math/units.hpp"
+#include "kf/memory/Array.hpp"
+
+/// @brief Enable UI instrumentation (0 - hooks compile to nothing)
+#if not defined(kf_UI_profiling)
+#define kf_UI_profiling 0
+#endif
+
+/// @brief Time enclosing scope into profiler entry
+/// @param profiler ui::Profiler instance
+/// @param entry Profiler entry expression (e.g. polls, widget(i))
+#if kf_UI_profiling
+#define kf_UI_profile(profiler, entry) const kf::ui::ProfileScope kf_UI_profile_scope{(profiler).clock, (profiler).entry}
+#else
+#define kf_UI_profile(profiler, entry)
+#endif
+
+
+namespace kf {// NOLINT(*-concat-nested-namespaces) // for c++11 capability
+namespace ui {
+
+/// @brief Accumulated duration statistics
+struct TimingStats {
+    u32 count{0};          ///< Measured calls
+    Microseconds min{0};   ///< Shortest call
+    Microseconds max{0};   ///< Longest call
+    u32 total{0};          ///< Sum of all calls (wraps after ~71 minutes of measured microseconds)
+
+    /// @brief Add measured duration
+    void add(Microseconds duration) noexcept {
+        min = (count == 0) ? duration : kf::min(min, duration);
+        max = kf::max(max, duration);
+        total += duration;
+        count += 1;
+    }
+
+    /// @brief Get mean duration
+    kf_nodiscard Microseconds mean() const noexcept { return (count == 0) ? 0 : total / count; }
+
+    /// @brief Clear statistics
+    void reset() noexcept { *this = {}; }
+};
+
+/// @brief Measures scope duration into TimingStats (no-op without clock)
+struct ProfileScope {
+
+private:
+    const Function<Microseconds()> &clock;
+    TimingStats &stats;
+    const Microseconds start;
+
+public:
+    explicit ProfileScope(const Function<Microseconds()> &clock, TimingStats &stats) noexcept:
+        clock{clock}, stats{stats}, start{clock ? clock() : 0} {}
+
+    ~ProfileScope() noexcept {
+        if (clock) { stats.add(clock() - start); }
+    }
+
+    ProfileScope(const ProfileScope &) = delete;
+};
+
+/// @brief UI timing collector
+/// @tparam W Widget entries (widgets beyond W accumulate into last entry)
+/// @tparam T Event type entries
+template<usize W, usize T> struct Profiler {
+    static_assert(W >= 1, "W >= 1");
+
+    static constexpr usize widget_entries{W};///< Widget entry count
+    static constexpr usize event_entries{T}; ///< Event type entry count
+
+    /// @brief Time source (e.g. micros, or CPU cycle counter for cycle-level timing)
+    Function<Microseconds()> clock{nullptr};
+
+    TimingStats polls{};                ///< Whole UI::poll calls
+    TimingStats frames{};               ///< Rendered frames
+    Array<TimingStats, T> events{};     ///< Event dispatch by event type
+    Array<TimingStats, W> widgets{};    ///< Widget rendering by widget index on page
+
+    /// @brief Get widget entry by widget index
+    kf_nodiscard TimingStats &widget(usize index) noexcept { return widgets[kf::min(index, W - 1)]; }
+
+    /// @brief Get event entry by event type index
+    kf_nodiscard TimingStats &event(usize type_index) noexcept { return events[type_index]; }
+
+    /// @brief Clear all statistics
+    void reset() noexcept {
+        polls.reset();
+        frames.reset();
+        for (auto &stats: events) { stats.reset(); }
+        for (auto &stats: widgets) { stats.reset(); }
+    }
+};
+
+} // namespace ui
+} // namespace kf
\ No newline at end of file
@@ -0,0 +1,557 @@
+// Copyright (c) 2026 KiraFlux
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstring>
+#include <limits>
+
+#include "kf/Function.hpp"
+#include "kf/Result.hpp"
+#include "kf/aliases.hpp"
+#include "kf/core/attributes.hpp"
+#include "kf/core/hash.hpp"
+#include "kf/memory/Array.hpp"
+#include "kf/memory/Slice.hpp"
+#include "kf/memory/StringView.hpp"
+#include "kf/ui/Render.hpp"
+
+
+namespace kf {// NOLINT(*-concat-nested-namespaces) // for c++11 capability
+namespace ui {
+
+static_assert(sizeof(f32) == sizeof(u32) and std::numeric_limits<f32>::is_iec559,
+              "Remote real operands are IEEE 754 binary32");
+
+/// @brief Remote UI stream operation codes
+/// @note Each operation is one code byte followed by its operands.
+/// Codes from SmallInt carry zigzag integer value in low 6 bits,
+/// codes from StringRef carry string table index of string value in low 7 bits.
+enum class RemoteOp : u8 {
+    Reset,        ///< Clear string table (stream resynchronization)
+    Prepare,      ///< u8 full
+    Finish,       ///< End of frame
+    Title,        ///< String operand
+    CheckboxOff,  ///< Disabled checkbox
+    CheckboxOn,   ///< Enabled checkbox
+    ValueString,  ///< String operand
+    ValueFalse,   ///< Boolean false value
+    ValueTrue,    ///< Boolean true value
+    ValueInt,     ///< Zigzag varint
+    ValueF32,     ///< IEEE 754 binary32, 4 bytes little-endian
+    ValueF64,     ///< Same as ValueF32 (narrowed to f32: double is 4 bytes on AVR), replayed as f64
+    Arrow,        ///< Arrow decoration
+    Colon,        ///< Colon separator
+    BeginFocused, ///< Begin contrast region
+    EndFocused,   ///< End contrast region
+    BeginBlock,   ///< Begin standard block
+    EndBlock,     ///< End standard block
+    BeginAltBlock,///< Begin alternative block
+    EndAltBlock,  ///< End alternative block
+    BeginWidget,  ///< u8 slot
+    NextWidget,   ///< Begin widget in slot following previous one
+    EndWidget,    ///< End of widget
+
+    SmallInt = 0x40, ///< Integer value in [-32, 31]
+    StringRef = 0x80,///< Stored string value
+};
+
+/// @brief String operand encoding (first byte of every string operand)
+/// @details Inline: 0, varint length, bytes.
+/// Define: 1, u8 index, varint length, bytes (stored into table at index).
+/// Reference: 2, u8 index.
+enum class RemoteString : u8 {
+    Inline,   ///< String sent as is
+    Define,   ///< String sent and stored into table
+    Reference,///< Previously defined string
+};
+
+/// @brief Remote UI stream decoding errors
+enum class RemoteError : u8 {
+    Truncated,          ///< Frame ends inside operation
+    UnknownOperation,   ///< Operation code is out of range
+    UnknownString,      ///< String reference to undefined table entry
+    StringTableOverflow,///< Defined string does not fit into table
+};
+
+/// @brief Table of strings repeated across frames (labels, titles)
+/// @tparam K Maximum number of entries
+/// @tparam P String pool capacity in bytes
+template<usize K, usize P> struct RemoteStringTable {
+    static_assert(K <= 128, "Entry index must fit in StringRef code");
+
+    /// @brief Longest string worth storing
+    static constexpr usize max_string_size{32};
+
+private:
+    struct Entry {
+        u32 hash;  ///< FNV-1a hash of contents
+        u16 offset;///< Position in pool
+        u8 size;   ///< Length in bytes
+    };
+
+    Array<Entry, K> entries{};
+    Array<char, P> pool{};
+    usize entries_count{0};
+    usize pool_size{0};
+
+public:
+    /// @brief Remove all entries
+    void clear() noexcept {
+        entries_count = 0;
+        pool_size = 0;
+    }
+
+    /// @brief Find entry index of string
+    /// @return Index or K if absent
+    kf_nodiscard usize find(StringView str) const noexcept {
+        const auto h = fnv1a(str);
+        for (usize i = 0; i < entries_count; i += 1) {
+            const auto &entry = entries[i];
+            if (entry.hash == h and entry.size == str.size() and
+                std::memcmp(pool.data() + entry.offset, str.data(), str.size()) == 0) {
+                return i;
+            }
+        }
+        return K;
+    }
+
+    /// @brief Check if string can be added
+    kf_nodiscard bool fits(StringView str) const noexcept {
+        return entries_count < K and str.size() <= max_string_size and pool_size + str.size() <= P;
+    }
+
+    /// @brief Store string at given index (entries are added in order)
+    /// @return false if index is not next entry or string does not fit
+    kf_nodiscard bool define(usize index, StringView str) noexcept {
+        if (index != entries_count or not fits(str)) { return false; }
+
+        std::memcpy(pool.data() + pool_size, str.data(), str.size());
+        entries[index] = Entry{fnv1a(str), static_cast<u16>(pool_size), static_cast<u8>(str.size())};
+        entries_count += 1;
+        pool_size += str.size();
+        return true;
+    }
+
+    /// @brief Get next entry index
+    kf_nodiscard usize size() const noexcept { return entries_count; }
+
+    /// @brief Get string by index
+    kf_nodiscard StringView at(usize index) const noexcept {
+        const auto &entry = entries[index];
+        return {pool.data() + entry.offset, entry.size};
+    }
+};
+
+/// @brief UI renderer serializing render calls into compact binary frames
+/// @tparam N Frame buffer capacity in bytes (must hold whole frame)
+/// @tparam K String table entries
+/// @tparam P String table pool size in bytes
+/// @note Frames are replayed onto another renderer by RemoteReplay with the same K and P.
+/// Frames must be delivered in order; after loss call resync().
+template<usize N, usize K = 32, usize P = 256> struct RemoteRender : Render<RemoteRender<N, K, P>> {
+    friend struct Render<RemoteRender<N, K, P>>;
+
+    /// @brief Remote renderer configuration settings
+    struct Config {
+        Function<void(Slice<const u8>)> on_frame{nullptr};///< Callback invoked with each encoded frame
+        usize widget_slots{3};                              ///< Widget slots of remote renderer
+        bool partial{false};                                ///< Remote renderer keeps slots between frames
+
+        Config(const Config &) = delete;
+    };
+
+    Config config{};///< Current renderer configuration
+
+    /// @brief Restart string table on next frame (e.g. remote side restarted or frame was lost)
+    void resync() noexcept { resync_required = true; }
+
+    /// @brief Get number of frames dropped due to buffer overflow
+    kf_nodiscard u32 overflows() const noexcept { return overflow_count; }
+
+private:
+    Array<u8, N> frame{};
+    usize frame_size{0};
+    RemoteStringTable<K, P> strings{};
+    u32 overflow_count{0};
+    bool overflow{false};
+    bool resync_required{true};
+    usize next_slot{0};
+
+    void writeByte(u8 byte) noexcept {
+        if (frame_size >= N) {
+            overflow = true;
+            return;
+        }
+        frame[frame_size] = byte;
+        frame_size += 1;
+    }
+
+    void writeOp(RemoteOp op) noexcept { writeByte(static_cast<u8>(op)); }
+
+    void writeBytes(const void *data, usize size) noexcept {
+        if (frame_size + size > N) {
+            overflow = true;
+            return;
+        }
+        std::memcpy(frame.data() + frame_size, data, size);
+        frame_size += size;
+    }
+
+    /// @brief Write real as binary32 little-endian regardless of host double size and byte order
+    void writeReal(f32 real) noexcept {
+        u32 bits;
+        std::memcpy(&bits, &real, sizeof(bits));
+        for (u8 i = 0; i < 4; i += 1) {
+            writeByte(static_cast<u8>(bits >> (8 * i)));
+        }
+    }
+
+    void writeVarint(u32 value) noexcept {
+        while (value >= 0x80) {
+            writeByte(static_cast<u8>(value | 0x80));
+            value >>= 7;
+        }
+        writeByte(static_cast<u8>(value));
+    }
+
+    void writeString(StringView str) noexcept {
+        const auto index = strings.find(str);
+
+        if (index < K) {
+            writeByte(static_cast<u8>(RemoteString::Reference));
+            writeByte(static_cast<u8>(index));
+            return;
+        }
+
+        if (strings.fits(str)) {
+            const auto next = strings.size();
+            (void) strings.define(next, str);
+            writeByte(static_cast<u8>(RemoteString::Define));
+            writeByte(static_cast<u8>(next));
+        } else {
+            writeByte(static_cast<u8>(RemoteString::Inline));
+        }
+
+        writeVarint(static_cast<u32>(str.size()));
+        writeBytes(str.data(), str.size());
+    }
+
+    // Render Interface Implementation
+
+    /// @note Frame after resync is always full: dropped frame already cleared widget dirty flags
+    kf_nodiscard bool partialImpl() const noexcept { return config.partial and not resync_required; }
+
+    kf_nodiscard usize widgetsAvailableImpl() const noexcept { return config.widget_slots; }
+
+    void prepareImpl(bool full) noexcept {
+        frame_size = 0;
+        overflow = false;
+
+        if (resync_required) {
+            resync_required = false;
+            strings.clear();
+            writeOp(RemoteOp::Reset);
+        }
+
+        writeOp(RemoteOp::Prepare);
+        writeByte(full ? 1 : 0);
+        next_slot = 0;
+    }
+
+    void finishImpl() noexcept {
+        writeOp(RemoteOp::Finish);
+
+        if (overflow) {
+            // Remote table is missing strings defined in dropped frame
+            overflow_count += 1;
+            resync_required = true;
+            return;
+        }
+
+        if (config.on_frame) {
+            config.on_frame(Slice<const u8>{frame.data(), frame_size});
+        }
+    }
+
+    void titleImpl(StringView title) noexcept {
+        writeOp(RemoteOp::Title);
+        writeString(title);
+    }
+
+    void checkboxImpl(bool enabled) noexcept { writeOp(enabled ? RemoteOp::CheckboxOn : RemoteOp::CheckboxOff); }
+
+    // Value rendering implementations
+    void valueImpl(StringView str) noexcept {
+        const auto index = strings.find(str);
+        if (index < K) {
+            writeByte(static_cast<u8>(static_cast<usize>(RemoteOp::StringRef) | index));
+            return;
+        }
+
+        writeOp(RemoteOp::ValueString);
+        writeString(str);
+    }
+
+    void valueImpl(bool value) noexcept { writeOp(value ? RemoteOp::ValueTrue : RemoteOp::ValueFalse); }
+
+    void valueImpl(i32 integer) noexcept {
+        const auto zigzag = (static_cast<u32>(integer) << 1) ^ static_cast<u32>(integer >> 31);
+        if (zigzag < 0x40) {
+            writeByte(static_cast<u8>(static_cast<u32>(RemoteOp::SmallInt) | zigzag));
+            return;
+        }
+
+        writeOp(RemoteOp::ValueInt);
+        writeVarint(zigzag);
+    }
+
+    void valueImpl(f32 real) noexcept {
+        writeOp(RemoteOp::ValueF32);
+        writeReal(real);
+    }
+
+    void valueImpl(f64 real) noexcept {
+        writeOp(RemoteOp::ValueF64);
+        writeReal(static_cast<f32>(real));
+    }
+
+    // Decoration rendering
+
+    void arrowImpl() noexcept { writeOp(RemoteOp::Arrow); }
+
+    void colonImpl() noexcept { writeOp(RemoteOp::Colon); }
+
+    void beginFocusedImpl() noexcept { writeOp(RemoteOp::BeginFocused); }
+
+    void endFocusedImpl() noexcept { writeOp(RemoteOp::EndFocused); }
+
+    void beginBlockImpl() noexcept { writeOp(RemoteOp::BeginBlock); }
+
+    void endBlockImpl() noexcept { writeOp(RemoteOp::EndBlock); }
+
+    void beginAltBlockImpl() noexcept { writeOp(RemoteOp::BeginAltBlock); }
+
+    void endAltBlockImpl() noexcept { writeOp(RemoteOp::EndAltBlock); }
+
+    void beginWidgetImpl(usize slot) noexcept {
+        if (slot == next_slot) {
+            writeOp(RemoteOp::NextWidget);
+        } else {
+            writeOp(RemoteOp::BeginWidget);
+            writeByte(static_cast<u8>(slot));
+        }
+        next_slot = slot + 1;
+    }
+
+    void endWidgetImpl() noexcept { writeOp(RemoteOp::EndWidget); }
+};
+
+/// @brief Decoder replaying RemoteRender frames onto local renderer
+/// @tparam K String table entries (same as encoder)
+/// @tparam P String table pool size in bytes (same as encoder)
+template<usize K = 32, usize P = 256> struct RemoteReplay {
+
+private:
+    RemoteStringTable<K, P> strings{};
+    usize next_slot{0};
+
+    kf_nodiscard static i32 unzigzag(u32 zigzag) noexcept {
+        return static_cast<i32>((zigzag >> 1) ^ (~(zigzag & 1) + 1));
+    }
+
+    /// @brief Frame reading cursor
+    struct Reader {
+        const u8 *position;
+        const u8 *end;
+
+        kf_nodiscard bool readByte(u8 &out) noexcept {
+            if (position >= end) { return false; }
+            out = *position;
+            position += 1;
+            return true;
+        }
+
+        kf_nodiscard bool readReal(f32 &out) noexcept {
+            if (end - position < 4) { return false; }
+            u32 bits = 0;
+            for (u8 i = 0; i < 4; i += 1) {
+                bits |= static_cast<u32>(position[i]) << (8 * i);
+            }
+            std::memcpy(&out, &bits, sizeof(out));
+            position += 4;
+            return true;
+        }
+
+        kf_nodiscard bool readVarint(u32 &out) noexcept {
+            out = 0;
+            for (u8 shift = 0; shift < 35; shift += 7) {
+                u8 byte;
+                if (not readByte(byte)) { return false; }
+                out |= static_cast<u32>(byte & 0x7F) << shift;
+                if ((byte & 0x80) == 0) { return true; }
+            }
+            return false;
+        }
+    };
+
+    kf_nodiscard Result<StringView, RemoteError> readString(Reader &reader) noexcept {
+        u8 kind;
+        if (not reader.readByte(kind)) { return {RemoteError::Truncated}; }
+
+        u8 index = 0;
+        if (kind != static_cast<u8>(RemoteString::Inline)) {
+            if (not reader.readByte(index)) { return {RemoteError::Truncated}; }
+        }
+
+        if (kind == static_cast<u8>(RemoteString::Reference)) {
+            if (index >= strings.size()) { return {RemoteError::UnknownString}; }
+            return {strings.at(index)};
+        }
+
+        u32 size;
+        if (not reader.readVarint(size)) { return {RemoteError::Truncated}; }
+        if (static_cast<usize>(reader.end - reader.position) < size) { return {RemoteError::Truncated}; }
+
+        const StringView str{reinterpret_cast<const char *>(reader.position), size};
+        reader.position += size;
+
+        if (kind == static_cast<u8>(RemoteString::Define)) {
+            if (not strings.define(index, str)) { return {RemoteError::StringTableOverflow}; }
+        } else if (kind != static_cast<u8>(RemoteString::Inline)) {
+            return {RemoteError::UnknownOperation};
+        }
+        return {str};
+    }
+
+public:
+    /// @brief Replay one encoded frame
+    /// @param frame Frame produced by RemoteRender
+    /// @param render Target renderer
+    /// @return Error if frame is malformed (target may have received part of frame, resync is required)
+    template<typename R> Result<void, RemoteError> replay(Slice<const u8> frame, Render<R> &render) noexcept {
+        Reader reader{frame.data(), frame.data() + frame.size()};
+
+        u8 code;
+        while (reader.readByte(code)) {
+            if (code >= static_cast<u8>(RemoteOp::StringRef)) {
+                const usize index = code & 0x7F;
+                if (index >= strings.size()) { return {RemoteError::UnknownString}; }
+                render.value(strings.at(index));
+                continue;
+            }
+
+            if (code >= static_cast<u8>(RemoteOp::SmallInt)) {
+                render.value(unzigzag(code & 0x3F));
+                continue;
+            }
+
+            switch (static_cast<RemoteOp>(code)) {
+                case RemoteOp::Reset:strings.clear();
+                    break;
+
+                case RemoteOp::Prepare: {
+                    u8 full;
+                    if (not reader.readByte(full)) { return {RemoteError::Truncated}; }
+                    render.prepare(full != 0);
+                    next_slot = 0;
+                }
+                    break;
+
+                case RemoteOp::Finish:render.finish();
+                    break;
+
+                case RemoteOp::Title:
+                case RemoteOp::ValueString: {
+                    auto str = readString(reader);
+                    if (str.isError()) { return {str.error().value()}; }
+
+                    if (code == static_cast<u8>(RemoteOp::Title)) {
+                        render.title(str.ok().value());
+                    } else {
+                        render.value(str.ok().value());
+                    }
+                }
+                    break;
+
+                case RemoteOp::CheckboxOff:render.checkbox(false);
+                    break;
+
+                case RemoteOp::CheckboxOn:render.checkbox(true);
+                    break;
+
+                case RemoteOp::ValueFalse:render.value(false);
+                    break;
+
+                case RemoteOp::ValueTrue:render.value(true);
+                    break;
+
+                case RemoteOp::ValueInt: {
+                    u32 zigzag;
+                    if (not reader.readVarint(zigzag)) { return {RemoteError::Truncated}; }
+                    render.value(unzigzag(zigzag));
+                }
+                    break;
+
+                case RemoteOp::ValueF32: {
+                    f32 real;
+                    if (not reader.readReal(real)) { return {RemoteError::Truncated}; }
+                    render.value(real);
+                }
+                    break;
+
+                case RemoteOp::ValueF64: {
+                    f32 real;
+                    if (not reader.readReal(real)) { return {RemoteError::Truncated}; }
+                    render.value(static_cast<f64>(real));
+                }
+                    break;
+
+                case RemoteOp::Arrow:render.arrow();
+                    break;
+
+                case RemoteOp::Colon:render.colon();
+                    break;
+
+                case RemoteOp::BeginFocused:render.beginFocused();
+                    break;
+
+                case RemoteOp::EndFocused:render.endFocused();
+                    break;
+
+                case RemoteOp::BeginBlock:render.beginBlock();
+                    break;
+
+                case RemoteOp::EndBlock:render.endBlock();
+                    break;
+
+                case RemoteOp::BeginAltBlock:render.beginAltBlock();
+                    break;
+
+                case RemoteOp::EndAltBlock:render.endAltBlock();
+                    break;
+
+                case RemoteOp::BeginWidget: {
+                    u8 slot;
+                    if (not reader.readByte(slot)) { return {RemoteError::Truncated}; }
+                    render.beginWidget(slot);
+                    next_slot = slot + 1;
+                }
+                    break;
+
+                case RemoteOp::NextWidget:render.beginWidget(next_slot);
+                    next_slot += 1;
+                    break;
+
+                case RemoteOp::EndWidget:render.endWidget();
+                    break;
+
+                default:return {RemoteError::UnknownOperation};
+            }
+        }
+        return {};
+    }
+};
+
+} // namespace ui
+} // namespace kf
\ No newline at end of file
@@ -23,21 +23,27 @@ template<typename Impl> struct Render {
 
     // Control operations
 
+    /// @brief Check if renderer keeps contents of widget slots between frames
+    /// @return true if frame may update only changed widgets, false if every frame is drawn from scratch
+    kf_nodiscard bool partial() noexcept { return impl().partialImpl(); }
+
     /// @brief Prepare render buffer for new frame
-    void prepare() noexcept { impl().prepareImpl(); }
+    /// @param full Whole page is redrawn (false - only changed widget slots follow)
+    void prepare(bool full) noexcept { impl().prepareImpl(full); }
 
     /// @brief Finalize frame after rendering
     void finish() noexcept { impl().finishImpl(); }
 
-    /// @brief Begin rendering specific widget
-    /// @param index Widget index in UI hierarchy
-    void beginWidget(usize index) noexcept { impl().beginWidgetImpl(index); }
+    /// @brief Begin rendering widget into its slot
+    /// @param slot Visible widget slot index (0 - first slot below title)
+    void beginWidget(usize slot) noexcept { impl().beginWidgetImpl(slot); }
 
     /// @brief Finish rendering current widget
     void endWidget() noexcept { impl().endWidgetImpl(); }
 
     /// @brief Get remaining widget rendering capacity
     /// @return Number of widgets that can still be rendered in current frame
+    /// @note Queried after title on full redraw, slot count is kept for following partial frames
     kf_nodiscard usize widgetsAvailable() noexcept { return impl().widgetsAvailableImpl(); }
 
     // Value rendering
@@ -0,0 +1,131 @@
+// Copyright (c) 2026 KiraFlux
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "kf/Function.hpp"
+#include "kf/algorithm.hpp"
+#include "kf/aliases.hpp"
+#include "kf/core/attributes.hpp"
+#include "kf/math/units.hpp"
+#include "kf/memory/Array.hpp"
+#include "kf/memory/Slice.hpp"
+
+
+namespace kf {// NOLINT(*-concat-nested-namespaces) // for c++11 capability
+namespace ui {
+
+/// @brief Scripted UI driver measuring event and render throughput
+/// @tparam U UI type (kf::UI instantiation)
+/// @tparam M Number of poll latency samples kept for percentiles
+/// @details Runs UI on simulated time without hardware: scripted events are queued when their
+/// timestamp is reached, poll() is called every poll_period. Frames are captured by renderer
+/// callbacks as usual (e.g. TextBufferRender on_render_finish or CanvasRender image).
+/// Works on host and on device.
+template<typename U, usize M = 1024> struct Simulator {
+    static_assert(M > 0, "Simulator needs latency storage");
+
+    using Event = typename U::Event;///< UI Event type
+
+    /// @brief Scripted input event
+    struct Step {
+        Milliseconds at;///< Simulated time of event
+        Event event;    ///< Event to queue
+    };
+
+    /// @brief Run results
+    struct Report {
+        u32 events{0};              ///< Scripted events offered to queue (including dropped)
+        u32 dropped{0};             ///< Events rejected by full queue
+        u32 polls{0};               ///< poll() calls
+        u32 frames{0};              ///< Frames rendered
+        Microseconds busy{0};       ///< Total time spent in poll()
+        f32 events_per_second{0};   ///< Events accepted by queue and processed per second of poll() time
+        f32 frames_per_second{0};   ///< Frames rendered per second of poll() time
+        Microseconds latency_p50{0};///< Median poll() latency
+        Microseconds latency_p90{0};///< 90th percentile poll() latency
+        Microseconds latency_p99{0};///< 99th percentile poll() latency
+        Microseconds latency_max{0};///< Worst poll() latency
+    };
+
+    U &ui;                                  ///< Simulated UI
+    Function<Microseconds()> clock{nullptr};///< Wall clock for latency (e.g. micros or std::chrono on host)
+    Milliseconds poll_period{10};           ///< Simulated time between polls
+
+private:
+    Array<Microseconds, M> latencies{};
+    Milliseconds time{0};///< Simulated time, continues across runs
+
+public:
+    explicit Simulator(U &ui) noexcept:
+        ui{ui} {}
+
+    /// @brief Replay script and poll UI until simulated time reaches end
+    /// @param script Events ordered by timestamp (relative to run start)
+    /// @param end Simulated time to stop at relative to run start (script is always replayed completely)
+    /// @return Run statistics (latencies are zero without clock)
+    Report run(Slice<const Step> script, Milliseconds end = 0) noexcept {
+        Report report{};
+
+        const auto frames_before = ui.renderStats().performed;
+        const auto dropped_before = ui.eventsDropped();
+
+        if (not script.empty()) {
+            end = kf::max(end, script.data()[script.size() - 1].at);
+        }
+
+        const auto period = kf::max<Milliseconds>(poll_period, 1);
+        usize next = 0;
+        usize samples = 0;
+
+        const auto base = time;
+
+        for (Milliseconds now = 0; now <= end or next < script.size(); now += period) {
+            for (; next < script.size() and script.data()[next].at <= now; next += 1) {
+                (void) ui.addEvent(script.data()[next].event);
+                report.events += 1;
+            }
+
+            const auto start = clock ? clock() : 0;
+            time = base + now;
+            ui.poll(time);
+            const auto latency = clock ? static_cast<Microseconds>(clock() - start) : 0;
+
+            // Oldest samples are overwritten on long runs
+            latencies[samples % M] = latency;
+            samples += 1;
+
+            report.polls += 1;
+            report.busy += latency;
+            report.latency_max = kf::max(report.latency_max, latency);
+        }
+
+        time += period;
+        report.frames = ui.renderStats().performed - frames_before;
+        report.dropped = ui.eventsDropped() - dropped_before;
+
+        if (report.busy > 0) {
+            // Rejected events were never processed, counting them inflates rate under overload
+            const auto processed = (report.events > report.dropped) ? report.events - report.dropped : 0;
+            report.events_per_second = static_cast<f32>(processed) * 1e6f / static_cast<f32>(report.busy);
+            report.frames_per_second = static_cast<f32>(report.frames) * 1e6f / static_cast<f32>(report.busy);
+        }
+
+        const auto count = kf::min(samples, M);
+        kf::sort(latencies.begin(), latencies.begin() + count);
+        report.latency_p50 = percentile(count, 50);
+        report.latency_p90 = percentile(count, 90);
+        report.latency_p99 = percentile(count, 99);
+
+        return report;
+    }
+
+private:
+    kf_nodiscard Microseconds percentile(usize count, usize percent) const noexcept {
+        if (count == 0) { return 0; }
+        return latencies[(count - 1) * percent / 100];
+    }
+};
+
+} // namespace ui
+} // namespace kf
\ No newline at end of file
@@ -16,16 +16,40 @@
 namespace kf {// NOLINT(*-concat-nested-namespaces) // for c++11 capability
 namespace ui {
 
+/// @brief Row patch settings of TextBufferRender (empty when row patches are disabled)
+template<bool Enabled> struct TextRowPatchConfig {};
+
+/// @brief Row patch settings of TextBufferRender
+template<> struct TextRowPatchConfig<true> {
+    /// @brief Row change handler
+    /// @details Row bytes starting at col (control codes included) are replaced by text, row ends after text.
+    /// Empty text truncates row at col.
+    using RowPatchHandler = Function<void(u8 row, usize col, StringView text)>;
+
+    RowPatchHandler on_row_patch{nullptr};///< Callback invoked for each row changed since previous frame
+};
+
+/// @brief Row diffing state of TextBufferRender (empty when row patches are disabled)
+template<usize N, bool Enabled> struct TextRowPatchState {};
+
+/// @brief Row diffing state of TextBufferRender
+template<usize N> struct TextRowPatchState<N, true> {
+    ArrayString<N> previous{};      ///< Previous frame text for row diffing
+    bool resync_required{true};     ///< Next frame patches all rows
+};
+
 /// @brief Text-based UI rendering system for terminal/console output
 /// @tparam N Text buffer capacity in characters
-/// @note Implements Render CRTP interface for character-based display
-template<usize N> struct TextBufferRender : Render<TextBufferRender<N>> {
-    friend struct Render<TextBufferRender<N>>;
+/// @tparam RowPatches Keep previous frame and report changed rows (on_row_patch), costs N more bytes
+/// @note Implements Render CRTP interface for character-based display.
+/// Frames are delivered whole (on_render_finish) and, with RowPatches, as row patches against previous frame
+template<usize N, bool RowPatches = false> struct TextBufferRender : Render<TextBufferRender<N, RowPatches>>, private TextRowPatchState<N, RowPatches> {
+    friend struct Render<TextBufferRender<N, RowPatches>>;
 
     using Glyph = u8; ///< Text interface measurement unit in glyphs
 
     /// @brief Text renderer configuration settings
-    struct Config {
+    struct Config : TextRowPatchConfig<RowPatches> {
         Function<void(StringView)> on_render_finish{nullptr}; ///< Callback invoked when rendering completes
 
         Glyph row_max_length{16};       ///< Maximum characters per row
@@ -40,6 +64,12 @@ template<usize N> struct TextBufferRender : Render<TextBufferRender<N>> {
     Config config{};          ///< Current renderer configuration
     ArrayString<N> buffer{};  ///< Output buffer for rendered text
 
+    /// @brief Patch every row on next frame (e.g. after remote display lost its contents)
+    void resync() noexcept {
+        static_assert(RowPatches, "TextBufferRender: resync() requires RowPatches");
+        this->resync_required = true;
+    }
+
 private:
     /// @brief Cursor state for tracking rendering position
     struct Cursor {
@@ -118,6 +148,48 @@ private:
         writeString(temp.view());
     }
 
+    /// @brief Take next row of frame text
+    /// @param frame Remaining frame text, advanced past taken row
+    kf_nodiscard static StringView takeRow(StringView &frame) noexcept {
+        auto end = frame.find('\n');
+
+        if (not end.hasValue()) {
+            const auto row = frame;
+            frame = {};
+            return row;
+        }
+
+        const auto row = frame.sub(0, end.value());
+        frame = frame.subFrom(end.value() + 1);
+        return row;
+    }
+
+    /// @brief Emit rows differing from previous frame, from first differing byte
+    void emitRowPatches() noexcept {
+        auto current_frame = buffer.view();
+        auto previous_frame = this->previous.view();
+
+        for (Glyph row = 0; row < config.rows_total; row += 1) {
+            const auto current = takeRow(current_frame);
+            const auto old = takeRow(previous_frame);
+
+            if (this->resync_required) {
+                config.on_row_patch(row, 0, current);
+                continue;
+            }
+
+            if (current == old) { continue; }
+
+            usize col = 0;
+            while (col < current.size() and col < old.size() and current[col] == old[col]) {
+                col += 1;
+            }
+            config.on_row_patch(row, col, current.subFrom(col));
+        }
+
+        this->resync_required = false;
+    }
+
 
     // Render Interface Implementation
 
@@ -130,7 +202,10 @@ private:
         }
     }
 
-    void prepareImpl() noexcept {
+    /// @brief Text buffer is rebuilt every frame
+    kf_nodiscard static constexpr bool partialImpl() noexcept { return false; }
+
+    void prepareImpl(bool) noexcept {
         buffer.clear();
         cursor.reset();
     }
@@ -139,6 +214,13 @@ private:
         if (config.on_render_finish) {
             config.on_render_finish(buffer.view());
         }
+
+        kf_if_constexpr (RowPatches) {
+            if (config.on_row_patch) {
+                emitRowPatches();
+                this->previous = buffer.view();
+            }
+        }
     }
 
     void titleImpl(StringView title) noexcept {